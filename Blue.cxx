@@ -31,8 +31,156 @@
 #include "TVectorD.h"
 #include "TMath.h"
 #include "TDatime.h"
+#include "RVersion.h"
+#include "RConfigure.h"
+#include <vector>
+#if defined(R__USE_IMT) && ROOT_VERSION_CODE >= ROOT_VERSION(6,10,0)
+#define Blue_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
 #include "Blue.h"
 
+//------------------------------------------------------------------------------
+// A second solver next to Solve(), on plain arrays and templated on the
+// scalar, only used by GetDerivative(). It repeats the positive definite
+// path of FillCov(), FillCovInvert() and Solve(), BlueDual carries in
+// addition the derivative w.r.t. one input through all operations. Solve()
+// does not use it, therefore GetDerivative() checks that its values agree
+// with the ones of Solve().
+//------------------------------------------------------------------------------
+
+namespace {
+
+struct BlueDual {
+  Double_t Val;
+  Double_t Der;
+  BlueDual(const Double_t v = 0, const Double_t d = 0) : Val(v), Der(d) {}
+};
+
+inline BlueDual operator+(const BlueDual &a, const BlueDual &b){
+  return BlueDual(a.Val + b.Val, a.Der + b.Der);
+}
+inline BlueDual operator-(const BlueDual &a, const BlueDual &b){
+  return BlueDual(a.Val - b.Val, a.Der - b.Der);
+}
+inline BlueDual operator*(const BlueDual &a, const BlueDual &b){
+  return BlueDual(a.Val * b.Val, a.Der * b.Val + a.Val * b.Der);
+}
+inline BlueDual operator/(const BlueDual &a, const BlueDual &b){
+  return BlueDual(a.Val / b.Val, (a.Der * b.Val - a.Val * b.Der) / (b.Val * b.Val));
+}
+
+inline Double_t BlueValue(const Double_t a){return a;}
+inline Double_t BlueValue(const BlueDual &a){return a.Val;}
+
+inline Double_t BlueSqrt(const Double_t a){return TMath::Sqrt(a);}
+inline BlueDual BlueSqrt(const BlueDual &a){
+  // A vanishing value has no derivative
+  Double_t s = TMath::Sqrt(a.Val);
+  if(s > 0)return BlueDual(s, a.Der / (2*s));
+  return BlueDual(s, 0);
+}
+
+// Cholesky factor L of the symmetric n x n matrix A, A = L * LT, returns 0
+// if A is not positive definite
+template<class T> Int_t BlueCholesky(const Int_t n, const T *A, T *L){
+  T d;
+  for(Int_t j = 0; j<n; j++){
+    for(Int_t i = 0; i<n; i++)L[i*n+j] = T(0);
+  }
+  for(Int_t j = 0; j<n; j++){
+    d = A[j*n+j];
+    for(Int_t p = 0; p<j; p++)d = d - L[j*n+p] * L[j*n+p];
+    if(BlueValue(d) <= 0)return 0;
+    L[j*n+j] = BlueSqrt(d);
+    for(Int_t i = j+1; i<n; i++){
+      d = A[i*n+j];
+      for(Int_t p = 0; p<j; p++)d = d - L[i*n+p] * L[j*n+p];
+      L[i*n+j] = d / L[j*n+j];
+    }
+  }
+  return 1;
+}
+
+// Replaces b by A-1 * b from the Cholesky factor L of A
+template<class T> void BlueCholSolve(const Int_t n, const T *L, T *b){
+  for(Int_t i = 0; i<n; i++){
+    for(Int_t p = 0; p<i; p++)b[i] = b[i] - L[i*n+p] * b[p];
+    b[i] = b[i] / L[i*n+i];
+  }
+  for(Int_t i = n-1; i>=0; i--){
+    for(Int_t p = i+1; p<n; p++)b[i] = b[i] - L[p*n+i] * b[p];
+    b[i] = b[i] / L[i*n+i];
+  }
+}
+
+// For NE estimates of NO observables with NU sources, the values X(i), the
+// uncertainties S(i+k*NE), the correlations C(k*NE*NE+i*NE+j) and the
+// matrix U(i*NO+n) it returns the results XRes(n), and URes(n*(NU+1)+k) the
+// uncertainty of result n from source k, with the total one at k = NU
+template<class T> Int_t BlueCore(const Int_t NE, const Int_t NO, const Int_t NU,
+				 const T *X, const T *S, const T *C, const Double_t *U,
+				 T *XRes, T *URes){
+  std::vector<T> Cov(NE*NE, T(0)), LC(NE*NE), H(NE*NO), G(NO*NO), LG(NO*NO);
+  std::vector<T> CovRes(NO*NO), Lam(NE*NO), b(TMath::Max(NE,NO));
+
+  // Cov = Sum_k Dk * Cork * Dk
+  for(Int_t k = 0; k<NU; k++){
+    for(Int_t i = 0; i<NE; i++){
+      for(Int_t j = 0; j<NE; j++){
+	Cov[i*NE+j] = Cov[i*NE+j] + S[i+k*NE] * C[k*NE*NE+i*NE+j] * S[j+k*NE];
+      }
+    }
+  }
+  if(BlueCholesky(NE, &Cov[0], &LC[0]) == 0)return 0;
+
+  // H = Cov-1 * U, CovRes = (UT * H)-1, Lam = H * CovRes
+  for(Int_t n = 0; n<NO; n++){
+    for(Int_t i = 0; i<NE; i++)b[i] = T(U[i*NO+n]);
+    BlueCholSolve(NE, &LC[0], &b[0]);
+    for(Int_t i = 0; i<NE; i++)H[i*NO+n] = b[i];
+  }
+  for(Int_t n = 0; n<NO; n++){
+    for(Int_t m = 0; m<NO; m++){
+      G[n*NO+m] = T(0);
+      for(Int_t i = 0; i<NE; i++)G[n*NO+m] = G[n*NO+m] + U[i*NO+n] * H[i*NO+m];
+    }
+  }
+  if(BlueCholesky(NO, &G[0], &LG[0]) == 0)return 0;
+  for(Int_t m = 0; m<NO; m++){
+    for(Int_t n = 0; n<NO; n++)b[n] = T(0);
+    b[m] = T(1);
+    BlueCholSolve(NO, &LG[0], &b[0]);
+    for(Int_t n = 0; n<NO; n++)CovRes[n*NO+m] = b[n];
+  }
+  for(Int_t i = 0; i<NE; i++){
+    for(Int_t n = 0; n<NO; n++){
+      Lam[i*NO+n] = T(0);
+      for(Int_t m = 0; m<NO; m++)Lam[i*NO+n] = Lam[i*NO+n] + H[i*NO+m] * CovRes[m*NO+n];
+    }
+  }
+
+  // XRes = LamT * X, the uncertainties from LamT * Dk * Cork * Dk * Lam
+  T Var;
+  for(Int_t n = 0; n<NO; n++){
+    XRes[n] = T(0);
+    for(Int_t i = 0; i<NE; i++)XRes[n] = XRes[n] + Lam[i*NO+n] * X[i];
+    for(Int_t k = 0; k<NU; k++){
+      Var = T(0);
+      for(Int_t i = 0; i<NE; i++){
+	for(Int_t j = 0; j<NE; j++){
+	  Var = Var + Lam[i*NO+n] * S[i+k*NE] * C[k*NE*NE+i*NE+j] * S[j+k*NE] * Lam[j*NO+n];
+	}
+      }
+      URes[n*(NU+1)+k] = BlueSqrt(Var);
+    }
+    URes[n*(NU+1)+NU] = BlueSqrt(CovRes[n*NO+n]);
+  }
+  return 1;
+}
+
+}
+
 // ----> First the implementation of the public member functions
 
 //------------------------------------------------------------------------------
@@ -41,6 +189,8 @@
 
 ClassImp(Blue);
 
+std::atomic<Int_t> Blue::IThrSaf(0);
+
 Blue::Blue(const Int_t NumEst, const Int_t NumUnc) : TObject() {
 
   // The NumObs=1 default
@@ -98,10 +248,6 @@ Blue::~Blue(){
   // Clean up all local objects
   //
 
-  // The Date
-  Date->~TDatime(); Date = NULL;
-  Months->~TString(); Months = NULL;
-  
   // The names of estimates, uncertainties and observables
   EstNam->~TString(); EstNam = NULL;
   UncNam->~TString(); UncNam = NULL;
@@ -114,28 +260,38 @@ Blue::~Blue(){
   delete EstObs; EstObs = NULL;
 
   // The matrix of scale factors
-  MatFac->Delete(); MatFac = NULL;
+  delete MatFac; MatFac = NULL;
 
   // The actual factors and ranges for SolveScaRho
-  ActFac->Delete(); ActFac = NULL;
-  MinFac->Delete(); MinFac = NULL;
-  MaxFac->Delete(); MaxFac = NULL;
+  delete ActFac; ActFac = NULL;
+  delete MinFac; MinFac = NULL;
+  delete MaxFac; MaxFac = NULL;
 
   // The number of scan values and the result matrices
   for(Int_t n = 0; n<InpObsOrig; n++){
-    ValSca[n]->Delete(); ValSca[n] = NULL;
-    SigSca[n]->Delete(); SigSca[n] = NULL;
-    VtoSca[n]->Delete(); VtoSca[n] = NULL;
-    StoSca[n]->Delete(); StoSca[n] = NULL;
+    delete ValSca[n]; ValSca[n] = NULL;
+    delete SigSca[n]; SigSca[n] = NULL;
+    delete VtoSca[n]; VtoSca[n] = NULL;
+    delete StoSca[n]; StoSca[n] = NULL;
+  }
+
+  // The derivatives of SolveSensitivity()
+  for(Int_t n = 0; n<InpObsOrig; n++){
+    delete ValSen[n]; ValSen[n] = NULL;
+    delete SigSen[n]; SigSen[n] = NULL;
   }
+  delete BasFac; BasFac = NULL;
+  delete BasFij; BasFij = NULL;
+  delete BasCovI; BasCovI = NULL;
+  delete BasCovU; BasCovU = NULL;
 
   // The lists of active estimates and uncertainties
   delete LisEst; LisEst = NULL;
   delete LisUnc; LisUnc = NULL;
 
   // The U-Matrices for the combination
-  Uma->Delete(); Uma = NULL;
-  Utr->Delete(); Utr = NULL;
+  delete Uma; Uma = NULL;
+  delete Utr; Utr = NULL;
 
   // Arrays for controlling the estimates
   delete EstAct; EstAct = NULL;
@@ -146,13 +302,15 @@ Blue::~Blue(){
   delete UncFac; UncFac = NULL;
   delete UncRed; UncRed = NULL;
   delete UncRel; UncRel = NULL;
+  delete [] UncDir; UncDir = NULL;
   
   // List of active observables and list of observables
   delete LisObs; LisObs = NULL;
   delete ObsAct; ObsAct = NULL;
 
   // Array of coefficients forBLUE with relative uncertainties
-  Cof->Delete(); Cof = NULL;
+  delete Cof; Cof = NULL;
+  delete HisRel; HisRel = NULL;
 
   // The list of importance and the steering flag for SolveAccImp
   delete LisImp; LisImp = NULL;
@@ -163,73 +321,99 @@ Blue::~Blue(){
   delete StaImp; StaImp = NULL;
   delete SysImp; SysImp = NULL;
 
-  // The arrays for PlotRes
-  delete Indx; Indx = NULL;
-  delete Colo; Colo = NULL;
-  Name->~TString(); Name = NULL;
-  delete Valu; Valu = NULL;
-  delete Stat; Stat = NULL;
-  delete Syst; Syst = NULL;
-  delete Full; Full = NULL;
-
   // The list of initial/final variances/correlations for SolveMaxVar
-  VarMax->Delete(); VarMax = NULL;
-  VarMin->Delete(); VarMin = NULL;
-  RhoMax->Delete(); RhoMax = NULL;
-  RhoMin->Delete(); RhoMin = NULL;
-  RhoOoz->Delete(); RhoOoz = NULL;
-  RhoFpk->Delete(); RhoFpk = NULL;
-  RhoFij->Delete(); RhoFij = NULL;
+  delete VarMax; VarMax = NULL;
+  delete VarMin; VarMin = NULL;
+  delete RhoMax; RhoMax = NULL;
+  delete RhoMin; RhoMin = NULL;
+  delete RhoOoz; RhoOoz = NULL;
+  delete RhoFpk; RhoFpk = NULL;
+  delete RhoFij; RhoFij = NULL;
   delete IFuFai; IFuFai = NULL;
 
   // Save harbor for all inputs
-  XvaOrig->Delete(); XvaOrig = NULL;
-  SigOrig->Delete(); SigOrig = NULL;
-  UncOrig->Delete(); UncOrig = NULL;
-  CorOrig->Delete(); CorOrig = NULL;
-  UmaOrig->Delete(); UmaOrig = NULL;
-  UtrOrig->Delete(); UtrOrig = NULL;
+  delete XvaOrig; XvaOrig = NULL;
+  delete SigOrig; SigOrig = NULL;
+  delete UncOrig; UncOrig = NULL;
+  for(Int_t k = 0; k<InpUncOrig; k++){
+    delete CorOrig[k]; CorOrig[k] = NULL;
+  }
+  delete [] CorOrig; CorOrig = NULL;
+  delete [] CorTypOrig; CorTypOrig = NULL;
+  delete UmaOrig; UmaOrig = NULL;
+  delete UtrOrig; UtrOrig = NULL;
 
    // Vectors to do the job
-  Xva->Delete(); Xva = NULL;
-  Sig->Delete(); Sig = NULL;
+  delete Xva; Xva = NULL;
+  delete Sig; Sig = NULL;
+
+  // Per source uncertainties and correlations
+  delete Unc; Unc = NULL;
+  for(Int_t k = 0; k<InpUncOrig; k++){
+    delete Cor[k]; Cor[k] = NULL;
+  }
+  delete [] Cor; Cor = NULL;
+  delete [] CorTyp; CorTyp = NULL;
 
   // Matrices to do the job
-  Unc->Delete(); Unc = NULL;
-  Cor->Delete(); Cor = NULL;
-  Cov->Delete(); Cov = NULL;
-  CovI->Delete(); CovI = NULL;
-  Rho->Delete(); Rho = NULL;
-  Lam->Delete(); Lam = NULL;
-  Pul->Delete(); Pul = NULL;
+  delete Cov; Cov = NULL;
+  delete CovL; CovL = NULL;
+  delete CovI; CovI = NULL;
+  delete CovD; CovD = NULL;
+  delete CovS; CovS = NULL;
+  delete CovW; CovW = NULL;
+  delete CovT; CovT = NULL;
+  delete Rho; Rho = NULL;
+  delete Lam; Lam = NULL;
+  delete Pul; Pul = NULL;
+
+  // The workspace
+  for(Int_t w = 0; w<WrkNum; w++){
+    delete WrkMat[w]; WrkMat[w] = NULL;
+  }
+  delete [] WrkMat; WrkMat = NULL;
+  delete WrkVec; WrkVec = NULL;
+  delete [] WrkInt; WrkInt = NULL;
+  for(Int_t w = 0; w<SloMax*SloNum; w++){
+    delete SloMat[w]; SloMat[w] = NULL;
+  }
+  delete [] SloMat; SloMat = NULL;
+  delete [] SloInt; SloInt = NULL;
+  delete [] SloAll; SloAll = NULL;
 
   // Matrices for the results
-  XvaRes->Delete(); XvaRes = NULL;
-  CorRes->Delete(); CorRes = NULL;
-  CovRes->Delete(); CovRes = NULL;
-  RhoRes->Delete(); RhoRes = NULL;
+  delete XvaRes; XvaRes = NULL;
+  delete CorRes; CorRes = NULL;
+  delete CovRes; CovRes = NULL;
+  delete RhoRes; RhoRes = NULL;
 
   // Vectors for the information weights
-  VarInd->Delete(); VarInd = NULL;
-  IntWei->Delete(); IntWei = NULL;
-  MarWei->Delete(); MarWei = NULL;
-  BluWei->Delete(); BluWei = NULL;
+  delete VarInd; VarInd = NULL;
+  delete IntWei; IntWei = NULL;
+  delete MarWei; MarWei = NULL;
+  delete BluWei; BluWei = NULL;
 
    // Matrices for the parameters
-  SRat->Delete(); SRat = NULL;
-  Beta->Delete(); Beta = NULL;
-  Sigx->Delete(); Sigx = NULL;
-  DBdr->Delete(); DBdr = NULL;
-  DSdr->Delete(); DSdr = NULL;
-  DBdz->Delete(); DBdz = NULL;
-  DSdz->Delete(); DSdz = NULL;
+  delete SRat; SRat = NULL;
+  delete Beta; Beta = NULL;
+  delete Sigx; Sigx = NULL;
+  delete DBdr; DBdr = NULL;
+  delete DSdr; DSdr = NULL;
+  delete DBdz; DBdz = NULL;
+  delete DSdz; DSdz = NULL;
 
   // Matrix for control of the relative uncertainties 
-  IndRel->Delete(); IndRel = NULL;
+  delete IndRel; IndRel = NULL;
   
   // Matrices for the InspectLike results
-  ChiRes->Delete(); ChiRes = NULL;
-  LikRes->Delete(); LikRes = NULL;
+  delete ChiCov; ChiCov = NULL;
+  delete ChiCovI; ChiCovI = NULL;
+  delete LikRes; LikRes = NULL;
+
+  // Matrices for the InspectToys results
+  delete ToyRes; ToyRes = NULL;
+  delete ToyPul; ToyPul = NULL;
+  delete ToyPro; ToyPro = NULL;
 
   // if(_name){delete _name; _name = 0;};
 
@@ -281,6 +465,12 @@ void Blue::FixInp(){
     return;
   }
 
+  // For an unchanged selection of estimates and uncertainties only rebuild
+  // the sources that changed since the last call, otherwise rebuild all.
+  // Until this call succeeds the next one has to rebuild all.
+  Int_t IFull = InpDir;
+  InpDir = 1;
+
   // Fill number and list of active estimates
   InpEst = 0;
   for(Int_t i = 0; i<InpEstOrig; i++){
@@ -320,7 +510,8 @@ void Blue::FixInp(){
   }
 
   // Fill U and UT matricees
-  TMatrixD *F  = new TMatrixD(InpEst,InpObs);
+  FillZero(&WrkMat[0], InpEst, InpObs);
+  TMatrixD *F  = WrkMat[0];
   Int_t j = 0;
   Int_t m = 0;
   for(Int_t i = 0; i<InpEstOrig; i++){
@@ -335,16 +526,16 @@ void Blue::FixInp(){
       m = 0;
     }
   }
-  Uma->Delete(); Uma = new TMatrixD(InpEst,InpObs);
-  Utr->Delete(); Utr = new TMatrixD(InpObs,InpEst);
+  FillZero(&Uma, InpEst, InpObs);
+  FillZero(&Utr, InpObs, InpEst);
   Uma->operator=(*F);
   Utr->Transpose(*Uma);
   //printf("... Blue->FixInp(): Uma \n"); Uma->Print();
   //printf("... Blue->FixInp(): Utr \n"); Utr->Print();
-  F->Delete(); F = NULL;
+  F = NULL;
 
   // Fill vector of estimates
-  Xva->Delete(); Xva = new TVectorD(InpEst);
+  FillZero(&Xva, InpEst);
   j = 0;
   for(Int_t i = 0; i<InpEstOrig; i++){
     if(IsActiveEst(i) == 1){
@@ -354,8 +545,9 @@ void Blue::FixInp(){
   }
   //printf("... Blue->FixInp(): Xva \n"); Xva->Print();
 
-  // Fill matrix of uncertainties
-  Unc->Delete(); Unc  = new TMatrixD(InpEst*InpUnc,InpEst*InpUnc);
+  // Fill vector of uncertainties
+  FillZero(&WrkVec, InpEst*InpUnc);
+  TVectorD *UN = WrkVec;
   Int_t IRow, IRowOrig;
   j = 0;
   Int_t l = 0;
@@ -367,7 +559,7 @@ void Blue::FixInp(){
 	if(IsActiveEst(i) == 1){
 	  IRowOrig=i+k*InpEstOrig;
 	  IRow=j+l*InpEst;
-	  UncCom = UncOrig->operator()(IRowOrig,IRowOrig);
+	  UncCom = UncOrig->operator()(IRowOrig);
 	  // Rescale relative uncertainties
 	  if(IsRelValUnc() == 1 && IsRelValUnc(k) == 1){
 	    ValCom = 0.;
@@ -378,40 +570,48 @@ void Blue::FixInp(){
 	    UncCom = CalcRelUnc(i, k, ValCom);
 	    if(UncCom < 0)IFail = IFail + 1;
 	  }
-	  Unc->operator()(IRow,IRow) = UncCom;
+	  UN->operator()(IRow) = UncCom;
 	  j = j + 1;
 	}
       }
       l = l + 1;
     }
   }
-  // printf("... Blue->FixInp(): Unc \n"); Unc->Print();
+  // printf("... Blue->FixInp(): Unc \n"); UN->Print();
   if(IFail >= 1){
     printf("... Blue->FixInp(): ---------------------------------------------------------- \n");
     printf("... Blue->FixInp(): !!! %2i relative uncertainties are not properly filled !!! \n", IFail);
     printf("... Blue->FixInp(): !!! NO COMBINATION POSSIBLE I will not fix the input   !!! \n");
     printf("... Blue->FixInp(): ---------------------------------------------------------- \n");
+    UN = NULL;
     return;
   }
+
+  // Flag the active sources with changed uncertainties
+  Int_t *IChaUnc = WrkInt;
+  for(Int_t k = 0; k<InpUnc; k++){
+    IChaUnc[k] = IFull;
+    for(Int_t i = 0; i<InpEst; i++){
+      if(IFull == 0 && UN->operator()(i+k*InpEst) != Unc->operator()(i+k*InpEst)){
+	IChaUnc[k] = 1;
+      }
+    }
+  }
   
-  // Fill matrix of correlations
-  //printf("... Blue->FixInp(): CorOrig \n"); CorOrig->Print();
-  TMatrixD *FN  = new TMatrixD(InpEst,InpEst);
-  TMatrixD *FO  = new TMatrixD(InpEstOrig,InpEstOrig);
-  TMatrixD *FS  = new TMatrixD(InpEstOrig,InpEstOrig);
-  TMatrixD *CC  = new TMatrixD(InpEst*InpUnc,InpEst*InpUnc);
+  // Fill matrices of correlations. Only re-do the ones flagged by the setters
+  FillZero(&WrkMat[1], InpEst, InpEst);
+  FillZero(&WrkMat[2], InpEstOrig, InpEstOrig);
+  TMatrixD *FN  = WrkMat[1];
+  TMatrixD *FO  = WrkMat[2];
   
   Int_t ii = 0;
   Int_t jj = 0;
   Int_t kk = 0;
-  Int_t IRowLow, IRowHig, IColLow, IColHig;
   for(Int_t k = 0; k<InpUncOrig; k++){ 
-    if(IsActiveUnc(k) == 1){
-      IRowLow = k*InpEstOrig; 
-      IRowHig = IRowLow + InpEstOrig-1;
-      IColLow = IRowLow;
-      IColHig = IRowHig;
-      CorOrig->GetSub(IRowLow, IRowHig, IColLow, IColHig, *FO, "S");
+    if(IsActiveUnc(k) == 1 && IFull == 0 && UncDir[k] == 0){
+      kk = kk + 1;
+    }else if(IsActiveUnc(k) == 1){
+      FO->operator=(*CorOrig[k]);
       //printf("... Blue->FixInp(): F0 \n"); FO->Print();
 
       // This is the place to do 1) changed, 2) scaled or 3) reduced
@@ -441,19 +641,20 @@ void Blue::FixInp(){
       // 3) Do the reduced correlations
       //UncOrig->Print();
       if(IsRhoRedUnc(k) == 1){
-	UncOrig->GetSub(IRowLow, IRowHig, IColLow, IColHig, *FS, "S");
-	//printf("... Blue->FixInp(): FS \n"); FS->Print();
 	//printf("... Blue->FixInp(): FO \n"); FO->Print();
 	Double_t RedCor, Limit = 0.00001, FullCor = 0.99;
+	Double_t Sigi1, Sigj1;
 	for(Int_t i1 = 0; i1<InpEstOrig; i1++){
 	  for(Int_t j1 = i1+1; j1<InpEstOrig; j1++){
-	    if(FS->operator()(i1,i1) < FS->operator()(j1,j1)){
-	      RedCor = FS->operator()(i1,i1) / FS->operator()(j1,j1);
+	    Sigi1 = UncOrig->operator()(i1+k*InpEstOrig);
+	    Sigj1 = UncOrig->operator()(j1+k*InpEstOrig);
+	    if(Sigi1 < Sigj1){
+	      RedCor = Sigi1 / Sigj1;
 	    }else{
-	      if(FS->operator()(i1,i1) > Limit){
-		RedCor = FS->operator()(j1,j1) / FS->operator()(i1,i1);
+	      if(Sigi1 > Limit){
+		RedCor = Sigj1 / Sigi1;
 	      }else{
-		RedCor = FS->operator()(j1,j1) / Limit;
+		RedCor = Sigj1 / Limit;
 	      }
 	    }
 	    //printf("... Blue->FixInp(): RC %2i, %2i,  %5.3f,  \n",i1,j1,RedCor); 
@@ -492,28 +693,50 @@ void Blue::FixInp(){
 	  jj = 0;
 	}
       }
-      IRowLow = kk*InpEst; 
-      IColLow = IRowLow;
-      CC->SetSub(IRowLow, IColLow, *FN);
+      if(IFull == 0){
+	for(Int_t i = 0; i<InpEst; i++){
+	  for(Int_t j = i+1; j<InpEst; j++){
+	    if(FN->operator()(i,j) != Cor[kk]->operator()(i,j))IChaUnc[kk] = 1;
+	  }
+	}
+      }
+      FillZero(&Cor[kk], InpEst, InpEst);
+      Cor[kk]->operator=(*FN);
+      //printf("... Blue->FixInp(): Cor[%2i] \n",kk); Cor[kk]->Print();
+
+      // Keep the type of the input, re-classify only modified correlations
+      if(IsRhoValUnc(k) == 0 && IsRhoFacUnc(k) == 0 && IsRhoRedUnc(k) == 0 && 
+	 (IsFutchCor() == 0 || k == 0)){
+	CorTyp[kk] = CorTypOrig[k];
+      }else{
+	CorTyp[kk] = IsWhichMatrix(Cor[kk]);
+	if(CorTyp[kk] > 2)CorTyp[kk] = 2;
+      }
       ii = 0;
       jj = 0;
       kk = kk + 1;
     }
   }
-  Cor->Delete(); Cor = new TMatrixD(InpEst*InpUnc,InpEst*InpUnc);
-  Cor->operator=(*CC);
-  FN->Delete(); FN = NULL;
-  FO->Delete(); FO = NULL;
-  FS->Delete(); FS = NULL;
-  CC->Delete(); CC = NULL;
-  //printf("... Blue->FixInp(): Cor \n"); Cor->Print();
+  FN = NULL;
+  FO = NULL;
+  FillZero(&Unc, InpEst*InpUnc);
+  Unc->operator=(*UN);
+  UN = NULL;
 
-  // Calculate covariance
-  FillCov();
+  // Calculate covariance and all that follows if anything changed. The sum
+  // is always re-done from scratch such that a scan that returns to the 
+  // same input also returns to the very same covariance.
+  Int_t IChange = 0;
+  for(Int_t k = 0; k<InpUnc; k++){
+    if(IChaUnc[k] == 1)IChange = 1;
+  }
+  if(IFull == 1)IChange = 1;
+  IChaUnc = NULL;
+  if(IChange == 1)FillCov();
   //printf("... Blue->FixInp(): Cov \n"); Cov->Print();
 
   // Calculate total uncertainties
-  FillSig();
+  if(IChange == 1)FillSig();
   //printf("... Blue->FixInp(): Sig \n"); Sig->Print();
 
   // Check for --zero-- total uncertainties of estimates, exit if this exists
@@ -529,11 +752,12 @@ void Blue::FixInp(){
   }
 
   // Calculate inverse covariance
-  FillCovInvert();
+  if(IChange == 1)FillCovInvert();
+  ChiFac = 0;
   //printf("... Blue->FixInp(): CovI \n"); CovI->Print();
 
   // Calculate input correlations
-  FillRho();
+  if(IChange == 1)FillRho();
   //printf("... Blue->FixInp(): Rho \n"); Rho->Print();
 
   // Check whether at least one each is left
@@ -557,7 +781,11 @@ void Blue::FixInp(){
   CalcParams();
 
   // Refresh the Likelihood matrix
-  LikRes->Delete(); LikRes = new TMatrixD(InpObs,LikDim);
+  FillZero(&LikRes, InpObs, LikDim);
+
+  // Nothing is left to be changed
+  InpDir = 0;
+  for(Int_t k = 0; k<InpUncOrig; k++)UncDir[k] = 0;
 
   // Set the flag 
   SetFixedInp(1);
@@ -575,7 +803,9 @@ void Blue::ReleaseInp(){
   SetIsSolvedInfWei(0);
   SetIsSolvedPosWei(0);
   SetIsSolvedMaxVar(0);
+  SetIsSolvedSensit(0);
   SetIsInspectLike(0);
+  SetIsInspectToys(0);
   SetCalcedParams(0);
   SetFutchCor(0,0,0,1);
 };
@@ -618,64 +848,107 @@ void Blue::Solve(){
   }
 
   // Reset weight matrix and pull vector
-  Lam->Delete(); Lam  = new TMatrixD(InpEst,InpObs);
-  Pul->Delete(); Pul  = new TVectorD(InpEst);
+  FillZero(&Lam, InpEst, InpObs);
+  FillZero(&Pul, InpEst);
 
   // Reset matrices for the results
-  XvaRes->Delete(); XvaRes = new TVectorD(InpObs);
-  CorRes->Delete(); CorRes = new TMatrixD(InpObs*InpUnc,InpObs*InpUnc);
-  CovRes->Delete(); CovRes = new TMatrixD(InpObs,InpObs);
-  RhoRes->Delete(); RhoRes = new TMatrixD(InpObs,InpObs);
+  FillZero(&XvaRes, InpObs);
+  FillZero(&CorRes, InpObs*InpUnc, InpObs*InpUnc);
+  FillZero(&CovRes, InpObs, InpObs);
+  FillZero(&RhoRes, InpObs, InpObs);
 
   // Get weight matrix
   //-1)      H: (Cov-1 * U)
   //-2) CovRes: (UT * Cov-1 * U)-1
   //-3)    Lam: (Cov-1 * U) * (UT * Cov-1 * U)-11 
-  TMatrixD *H = new TMatrixD(InpEst,InpObs);
-  H->Mult(*CovI, *Uma);
-  CovRes->Mult(*Utr,*H);
-  CovRes->Invert();
+  // For a positive definite covariance use the Cholesky factors of
+  // Cov and (UT * Cov-1 * U) instead of explicit inversions
+  FillZero(&WrkMat[6], InpEst, InpObs);
+  FillZero(&WrkMat[7], InpObs, InpObs);
+  TMatrixD *H = WrkMat[6];
+  TMatrixD *G = WrkMat[7];
+  if(IsPosDefCov() == 1){
+    H->operator=(*Uma);
+    CalcCovSolve(H);
+    CovRes->Mult(*Utr,*H);
+    if(CalcCholesky(CovRes, G) == 1){
+      CalcCholInvert(G, CovRes);
+    }else{
+      CovRes->Invert();
+    }
+  }else{
+    H->Mult(*CovI, *Uma);
+    CovRes->Mult(*Utr,*H);
+    CovRes->Invert();
+  }
   Lam->Mult(*H, *CovRes);
-  H->Delete(); H = NULL;
+  H = NULL;
+  G = NULL;
   //printf("... Blue->Solve(): Weight matrix\n"); Lam->Print();
 
-  // Calculate covariance matrix of observables per uncertainty source
-  TMatrixD *C = new TMatrixD(InpEst,InpEst);
-  TMatrixD *E = new TMatrixD(InpEst,InpEst);
-  TMatrixD *F = new TMatrixD(InpEst,InpEst);
-  TMatrixD *I = new TMatrixD(InpEst,InpEst);
-  
-  TMatrixD *J = new TMatrixD(InpEst,InpObs);
-  TMatrixD *K = new TMatrixD(InpObs,InpEst);
-  TMatrixD *L = new TMatrixD(InpObs,InpObs);
-  
-  Int_t IRowLow, IRowHig, IColLow, IColHig;
+  // Calculate covariance matrix of observables per uncertainty source, Eq 18.
+  // Cov(n,m)_k = Lam(i,n)*Cov(i,j)_k*Lam(j,m) = WkT * Cork * Wk, with 
+  // Wk = Dk * Lam the weights scaled by the uncertainties of source k.
+  // As in FillCov() the correlation is applied by its type, uncorrelated
+  // sources give WkT * Wk, fully correlated ones the outer product of the
+  // column sums of Wk, and only general ones need Cork * Wk. The symmetric
+  // blocks go straight into CorRes, which is zero outside of them.
+  FillZero(&WrkMat[8], InpEst, InpObs);
+  FillZero(&WrkMat[9], InpEst, InpObs);
+  FillZero(&WrkMat[10], InpObs, InpObs);
+  FillZero(&WrkMat[11], InpObs, 1);
+  TMatrixD *W = WrkMat[8];
+  TMatrixD *J = WrkMat[9];
+  TMatrixD *L = WrkMat[10];
+  TMatrixD *T = WrkMat[11];
+
+  Double_t Sik, Val;
   for(Int_t k = 0; k<InpUnc; k++){
-    // Get covariance matrix per uncertainty source
-    IRowLow = k*InpEst; 
-    IRowHig = IRowLow + InpEst-1;
-    IColLow = IRowLow;
-    IColHig = IRowHig;
-    Unc->GetSub(IRowLow, IRowHig, IColLow, IColHig, *E, "S");
-    Cor->GetSub(IRowLow, IRowHig, IColLow, IColHig, *C, "S");
-    F->Mult(*E, *C);
-    I->Mult(*F, *E);
-    //printf("... Blue->Solve(): Cov_i \n"); I->Print();
-    // Get covariance Eq 18. Cov(n,m)_k = Lam(n,i)*Cov(i,j)_k*Lam(j,m)
-    J->Mult(*I, *Lam);
-    K->Transpose(*Lam);
-    L->Mult(*K,*J);
-    L->Sqrt();
-    CorRes->SetSub(k*InpObs,k*InpObs,*L);
+    for(Int_t i = 0; i<InpEst; i++){
+      Sik = Unc->operator()(i+k*InpEst);
+      for(Int_t n = 0; n<InpObs; n++){
+	W->operator()(i,n) = Sik * Lam->operator()(i,n);
+      }
+    }
+    if(CorTyp[k] == 0){
+      for(Int_t n = 0; n<InpObs; n++){
+	for(Int_t m = n; m<InpObs; m++){
+	  Val = 0;
+	  for(Int_t i = 0; i<InpEst; i++)Val = Val + W->operator()(i,n) * W->operator()(i,m);
+	  L->operator()(n,m) = Val;
+	}
+      }
+    }else if(CorTyp[k] == 1){
+      for(Int_t n = 0; n<InpObs; n++){
+	Val = 0;
+	for(Int_t i = 0; i<InpEst; i++)Val = Val + W->operator()(i,n);
+	T->operator()(n,0) = Val;
+      }
+      for(Int_t n = 0; n<InpObs; n++){
+	for(Int_t m = n; m<InpObs; m++)L->operator()(n,m) = T->operator()(n,0) * T->operator()(m,0);
+      }
+    }else{
+      J->Mult(*Cor[k], *W);
+      for(Int_t n = 0; n<InpObs; n++){
+	for(Int_t m = n; m<InpObs; m++){
+	  Val = 0;
+	  for(Int_t i = 0; i<InpEst; i++)Val = Val + W->operator()(i,n) * J->operator()(i,m);
+	  L->operator()(n,m) = Val;
+	}
+      }
+    }
+    for(Int_t n = 0; n<InpObs; n++){
+      for(Int_t m = n; m<InpObs; m++){
+	CorRes->operator()(k*InpObs+n,k*InpObs+m) = TMath::Sqrt(L->operator()(n,m));
+	CorRes->operator()(k*InpObs+m,k*InpObs+n) = CorRes->operator()(k*InpObs+n,k*InpObs+m);
+      }
+    }
     //CorRes->Print();     
   }
-  C->Delete(); C = NULL;
-  E->Delete(); E = NULL;
-  F->Delete(); F = NULL;
-  I->Delete(); I = NULL;
-  J->Delete(); J = NULL;
-  K->Delete(); K = NULL;
-  L->Delete(); L = NULL;
+  W = NULL;
+  J = NULL;
+  L = NULL;
+  T = NULL;
 
   // Calculate correlation matrix of results
   RhoRes->SetSub(0,0,*CovRes);
@@ -707,12 +980,16 @@ void Blue::Solve(){
   // Calculate Pull (yi - y)/sqrt(sig_yi^2-sig_y^2)
   //-1) N: (Xva - U * XvaRes)
   //-2) O: N^T
-  //-3) M: (CovI * N)
+  //-3) M: (CovI * N), from the Cholesky factor if available
   //-3) P: chiq: (O * M)
-  TMatrixD *M = new TMatrixD(InpEst,1);
-  TMatrixD *N = new TMatrixD(InpEst,1);
-  TMatrixD *O = new TMatrixD(1,InpEst);
-  TMatrixD *P = new TMatrixD(1,1);
+  FillZero(&WrkMat[12], InpEst, 1);
+  FillZero(&WrkMat[13], InpEst, 1);
+  FillZero(&WrkMat[14], 1, InpEst);
+  FillZero(&WrkMat[15], 1, 1);
+  TMatrixD *M = WrkMat[12];
+  TMatrixD *N = WrkMat[13];
+  TMatrixD *O = WrkMat[14];
+  TMatrixD *P = WrkMat[15];
 
   // Fill N, calculate O, use val from above
   // Calculate Pull on the fly
@@ -732,7 +1009,12 @@ void Blue::Solve(){
       sqrt(Sig->operator()(i) * Sig->operator()(i) - unc);
   }
   O->Transpose(*N);
-  M->Mult(*CovI, *N);
+  if(IsPosDefCov() == 1){
+    M->operator=(*N);
+    CalcCovSolve(M);
+  }else{
+    M->Mult(*CovI, *N);
+  }
   P->Mult(*O, *M);
   //M->Print(); N->Print(); O->Print(); P->Print(); 
   //Pul->Print();
@@ -743,7 +1025,7 @@ void Blue::Solve(){
   ChiPro = TMath::Prob(ChiQua,NumDof);
 
   // Clean up
-  M->Delete(); N->Delete(); O->Delete(); P->Delete();
+  M = NULL; N = NULL; O = NULL; P = NULL;
   
   // Success
   SetIsSolved(1);
@@ -800,16 +1082,61 @@ void Blue::SolveRelUnc(const Double_t Dx){
   // Set relative uncertainty flag
   SetRelValUnc(1);
 
-  // Loop until convergence, or at most ILm times
-  Int_t    Iok = 0, ILo = 0, ILm = 200;
-  Double_t Old = 0, New = 0, Del = 0;
-  TVectorD* XvaResLast = new TVectorD(GetActObs());
+  // Loop until convergence, or at most ILm times. Only the uncertainties
+  // change from one iteration to the next, such that FixInp() keeps the
+  // correlations. The fixed point x = G(x) of the map from the last combined
+  // values x to the new ones G(x) is found with a one step Anderson mixing
+  //   x(l+1) = G(l) - Gam * (G(l) - G(l-1)),  Gam = DR*R(l) / DR*DR
+  // with R(l) = G(l) - x(l) and DR = R(l) - R(l-1).
+  Int_t    Iok = 0, ILo = 0, ILm = 200, IAcc = 0;
+  Double_t Old = 0, New = 0, Del = 0, Gam = 0, Num = 0, Den = 0;
+  // The rows of Las are the last values x(l), the last G(l) and R(l)
+  FillZero(&WrkMat[36], 3, GetActObs());
+  TMatrixD *Las = WrkMat[36];
+  NumRel = 0;
+  FillZero(&HisRel, ILm+1, GetActObs());
+  for(Int_t n = 0; n<GetActObs(); n++){
+    HisRel->operator()(0,n) = XvaRes->operator()(n);
+  }
   while(Iok == 0){
     Iok = 1;
     ILo = ILo + 1;
+    // If the accelerated values give unphysical uncertainties fall back
+    // to the plain iteration. Test this here, as FixInp() would report
+    // a failed combination
+    if(IAcc == 1){
+      Int_t IPhy = 1, i = 0;
+      Double_t ValCom = 0, VarCom = 0, VarSum = 0;
+      for(Int_t j = 0; j<InpEst; j++){
+	i = LisEst[j];
+	ValCom = 0;
+	for(Int_t n = 0; n<InpObs; n++){
+	  ValCom = ValCom + Uma->operator()(j,n)*XvaRes->operator()(n);
+	}
+	VarSum = 0;
+	for(Int_t k = 0; k<InpUncOrig; k++){
+	  if(IsActiveUnc(k) == 1){
+	    if(IsRelValUnc() == 1 && IsRelValUnc(k) == 1){
+	      VarCom = CalcRelVar(i, k, ValCom);
+	      if(VarCom < 0)IPhy = 0;
+	    }else{
+	      VarCom = UncOrig->operator()(i+k*InpEstOrig) * UncOrig->operator()(i+k*InpEstOrig);
+	    }
+	    VarSum = VarSum + VarCom;
+	  }
+	}
+	// The negated test also catches a NaN
+	if(!(VarSum > 0))IPhy = 0;
+      }
+      if(IPhy == 0){
+	for(Int_t n = 0; n<GetActObs(); n++){
+	  XvaRes->operator()(n) = Las->operator()(1,n);
+	}
+      }
+    }
     // Save result from last iteration
     for(Int_t n = 0; n<GetActObs(); n++){
-      XvaResLast->operator()(n) = XvaRes->operator()(n);
+      Las->operator()(0,n) = XvaRes->operator()(n);
     }
     // Solve next time
     ReleaseInp();
@@ -820,27 +1147,54 @@ void Blue::SolveRelUnc(const Double_t Dx){
     }
     // Loop over observables and estimates check difference
     for(Int_t n = 0; n<GetActObs(); n++){
-      Old = XvaResLast->operator()(n);
+      Old = Las->operator()(0,n);
       New = XvaRes->operator()(n);
       Del = 100.*TMath::Abs(1.-New/Old);
       if(Del > Dx)Iok = 0;
       if(IsPrintLevel() >= 1){
 	printf("... Blue->SolveRelUnc(%5.3f%%): Old, New, Dif = %7.5f %7.5f %7.5f %% \n", Dx, Old, New, Del);
       }
+      HisRel->operator()(ILo,n) = New;
     }
+    NumRel = ILo;
     if(ILo == ILm && Iok == 0){
       printf("... Blue->SolveRelUnc(%5.3f%%): No convergence after %3i iterations.", Dx, ILo);
       printf(" I give up and take the result from the last iteration. \n");
       Iok = 1;
       ILo = 0;
     }
+
+    // Get the input for the next iteration
+    if(Iok == 0){
+      Num = 0;
+      Den = 0;
+      for(Int_t n = 0; n<GetActObs(); n++){
+	New = XvaRes->operator()(n) - Las->operator()(0,n);
+	Del = New - Las->operator()(2,n);
+	Num = Num + Del * New;
+	Den = Den + Del * Del;
+	Las->operator()(2,n) = New;
+      }
+      IAcc = 0;
+      if(ILo > 1 && Den > 0){
+	IAcc = 1;
+	Gam = Num / Den;
+      }
+      for(Int_t n = 0; n<GetActObs(); n++){
+	New = XvaRes->operator()(n);
+	if(IAcc == 1){
+	  XvaRes->operator()(n) = New - Gam * (New - Las->operator()(1,n));
+	}
+	Las->operator()(1,n) = New;
+      }
+    }
   }
   if(ILo != 0 && IsQuiet() == 0){
     printf("... Blue->SolveRelUnc(%5.3f%%): Success after %2i iterations \n", Dx, ILo);
   }
 
   // Clean up
-  XvaResLast->Delete(); XvaResLast = NULL; 
+  Las = NULL;
 
   // Clear relative uncertainty flag
   SetRelValUnc(0);
@@ -911,12 +1265,12 @@ void Blue::SolveAccImp(const Int_t ImpFla, const Double_t Dx){
   SetQuiet(1);
 
   // Reset matrices
-  LasImp->Delete(); LasImp = new TMatrixD(1,InpObs);
-  IndImp->Delete(); IndImp = new TMatrixD(InpEst,InpObs);
-  ValImp->Delete(); ValImp = new TMatrixD(InpEst,InpObs);
-  UncImp->Delete(); UncImp = new TMatrixD(InpEst,InpObs);
-  StaImp->Delete(); StaImp = new TMatrixD(InpEst,InpObs);
-  SysImp->Delete(); SysImp = new TMatrixD(InpEst,InpObs);
+  FillZero(&LasImp, 1, InpObs);
+  FillZero(&IndImp, InpEst, InpObs);
+  FillZero(&ValImp, InpEst, InpObs);
+  FillZero(&UncImp, InpEst, InpObs);
+  FillZero(&StaImp, InpEst, InpObs);
+  FillZero(&SysImp, InpEst, InpObs);
 
   // Save weights according to ImpFla in an interim matrix
   // Save the number of estimates per observable
@@ -1009,7 +1363,7 @@ void Blue::SolveAccImp(const Int_t ImpFla, const Double_t Dx){
     //printf("... Blue->SolveAccImp(): IndImp \n"); IndImp->Print();
     ValImp->operator()(0,n) = Xva->operator()(ActPre);
     UncImp->operator()(0,n) = Sig->operator()(ActPre);
-    StaImp->operator()(0,n) = Unc->operator()(0*InpEst+ActPre,0*InpEst+ActPre);
+    StaImp->operator()(0,n) = Unc->operator()(0*InpEst+ActPre);
     SysImp->operator()(0,n) = TMath::Sqrt(UncImp->operator()(0,n)*UncImp->operator()(0,n)-
 					  StaImp->operator()(0,n)*StaImp->operator()(0,n));
 
@@ -1025,31 +1379,37 @@ void Blue::SolveAccImp(const Int_t ImpFla, const Double_t Dx){
       printf("\n");
     }
   
-    // Disable all but the most precise estimate 
-    ReleaseInp();
-    for(Int_t i = 1; i<NnrEst[n]; i++){SetInActiveEst(LisImp[i]);};
-    FixInp();
-      
-    // Add one at a time for decreasing importance, store results
-    for(Int_t i = 1; i<NnrEst[n]; i++){
-      ReleaseInp();      
-      SetActiveEst(LisImp[i]);
+    // Add one at a time for decreasing importance, store results. This is
+    // done by updating the inverse covariance with CalcAccImp(). The full
+    // solution per step is only needed for the print out, and for relative
+    // uncertainties that depend on the combined value.
+    if(IsPrintLevel() > 0 || IsRelValUnc() == 1 || CalcAccImp(n, ActPre, NnrEst[n]) == 0){
+
+      // Disable all but the most precise estimate 
+      ReleaseInp();
+      for(Int_t i = 1; i<NnrEst[n]; i++){SetInActiveEst(LisImp[i]);};
       FixInp();
-      Solve();
-      if(IsPrintLevel() > 0){
-	printf("... Blue->SolveAccImp(): Add %2i, %s \n", LisImp[i],GetNamEst(IsWhichEst(i)).Data());
-	PrintEst(ActPre);
-	PrintResult();
+      
+      for(Int_t i = 1; i<NnrEst[n]; i++){
+	ReleaseInp();      
+	SetActiveEst(LisImp[i]);
+	FixInp();
+	Solve();
+	if(IsPrintLevel() > 0){
+	  printf("... Blue->SolveAccImp(): Add %2i, %s \n", LisImp[i],GetNamEst(IsWhichEst(i)).Data());
+	  PrintEst(ActPre);
+	  PrintResult();
+	}
+	ValImp->operator()(i,n) = XvaRes->operator()(n);
+	UncImp->operator()(i,n) = TMath::Sqrt(CovRes->operator()(n,n));
+	StaImp->operator()(i,n) = CorRes->operator()(0*InpObs+n,0*InpObs+n);
+	SysImp->operator()(i,n) = TMath::Sqrt(UncImp->operator()(i,n)*UncImp->operator()(i,n)-
+					      StaImp->operator()(i,n)*StaImp->operator()(i,n));
       }
-      ValImp->operator()(i,n) = XvaRes->operator()(n);
-      UncImp->operator()(i,n) = TMath::Sqrt(CovRes->operator()(n,n));
-      StaImp->operator()(i,n) = CorRes->operator()(0*InpObs+n,0*InpObs+n);
-      SysImp->operator()(i,n) = TMath::Sqrt(UncImp->operator()(i,n)*UncImp->operator()(i,n)-
-					    StaImp->operator()(i,n)*StaImp->operator()(i,n));
-    }
 
-    // Solve once if only one estimate for this observable
-    if(NnrEst[n] == 1)Solve();
+      // Solve once if only one estimate for this observable
+      if(NnrEst[n] == 1)Solve();
+    }
 
     //printf("... Blue->SolveAccImp(): XvaRes \n"); XvaRes->Print();
     //printf("... Blue->SolveAccImp(): CovRes \n"); CovRes->Print();
@@ -1061,7 +1421,7 @@ void Blue::SolveAccImp(const Int_t ImpFla, const Double_t Dx){
     //printf("... Blue->SolveAccImp(): SysImp \n"); SysImp->Print();
     //printf("... Blue->SolveAccImp():    Wei \n"); Wei->Print();
   }
-  Wei->Delete(); Wei = NULL;
+  delete Wei; Wei = NULL;
 
   // Find the last estimate to be combined
   Double_t DifVal = 0, DifUnc = 0;
@@ -1139,8 +1499,8 @@ void Blue::SolveScaRho(const Int_t RhoFla, const Double_t *MinRho, const Double_
   FlaFac = RhoFla;
 
   // Take the input
-  MaxFac->Delete(); MaxFac = new TMatrixD(InpUncOrig,InpFac,MaxRho,"MaxFac");
-  MinFac->Delete(); MinFac = new TMatrixD(InpUncOrig,InpFac,MinRho,"MinFac");
+  delete MaxFac; MaxFac = new TMatrixD(InpUncOrig,InpFac,MaxRho,"MaxFac");
+  delete MinFac; MinFac = new TMatrixD(InpUncOrig,InpFac,MinRho,"MinFac");
      
   // Check for consistency
   Int_t IC = 1;
@@ -1205,35 +1565,39 @@ void Blue::SolveInfWei(){
   }
 
   // Reset vectors for information weights
-  VarInd->Delete(); VarInd = new TVectorD(InpEstOrig);
-  IntWei->Delete(); IntWei = new TVectorD(InpEstOrig+1);
-  MarWei->Delete(); MarWei = new TVectorD(InpEstOrig);
-  BluWei->Delete(); BluWei = new TVectorD(InpEstOrig);
+  FillZero(&VarInd, InpEstOrig);
+  FillZero(&IntWei, InpEstOrig+1);
+  FillZero(&MarWei, InpEstOrig);
+  FillZero(&BluWei, InpEstOrig);
 
   // Go to quiet modus
   SetQuiet(1);
 
-  // Solve for all but one, save the variances
-  ReleaseInp();
-  for(Int_t i = 0; i<InpEstOrig; i++){
-    if(IsActiveEst(i)){
-      SetInActiveEst(i);
-      FixInp();
-      Solve();
-      ReleaseInp();
-      SetActiveEst(i);
-      VarInd->operator()(i) = CovRes->operator()(0,0);
-    }
-  }
-  //printf("... Blue->SolveInfWei(): VarInd\n"); VarInd->Print();
-  
   // Solve with all estimates, save 
   // 1) variance of the result
   // 2) variances of the active estimates
   // 3) Blue weights of the active estimates
-  FixInp();
   Solve();
   //printf("... Blue->SolveInfWei(): Sig \n"); Sig->Print();  
+
+  // Get the variances of the combinations of all but one estimate from the 
+  // inverse covariance P = Cov-1. For one observable U = (1,...,1) and 
+  // Var_comb(all) = 1/F with F = Sum_ij P(i,j). Removing estimate i gives 
+  // Var_comb(all-i) = 1/(F - r(i)^2/P(i,i)) with r(i) = Sum_j P(i,j)
+  TVectorD *R = new TVectorD(InpEst);
+  Double_t F = 0;
+  for(Int_t i = 0; i<InpEst; i++){
+    for(Int_t j = 0; j<InpEst; j++){
+      R->operator()(i) = R->operator()(i) + CovI->operator()(i,j);
+    }
+    F = F + R->operator()(i);
+  }
+  for(Int_t i = 0; i<InpEst; i++){
+    VarInd->operator()(IsWhichEst(i)) = 1. / 
+      (F - R->operator()(i) * R->operator()(i) / CovI->operator()(i,i));
+  }
+  delete R; R = NULL;
+  //printf("... Blue->SolveInfWei(): VarInd\n"); VarInd->Print();
   for(Int_t i = 0; i<InpEst; i++){
     IntWei->operator()(IsWhichEst(i)) = Sig->operator()(i)* Sig->operator()(i);  
     BluWei->operator()(IsWhichEst(i)) = Lam->operator()(i,0);
@@ -1288,38 +1652,84 @@ void Blue::SolvePosWei(){
   Solve();
 
   // Due to de-activation of estimates new estimates can get negative weights
-  // Iterate until all are positive
+  // Iterate until all are positive. This is done on a copy P of the inverse
+  // covariance. Removing estimate i from the active set is a rank one update
+  //   P(a,b) = P(a,b) - P(a,i) * P(i,b) / P(i,i)
+  // and the weights follow from Lam = P * U * (UT * P * U)-1. 
+  // Only the final set of estimates is fixed and solved again.
   TVectorD* IDeAct = new TVectorD(InpEstOrig);
   Int_t NDeAct = 1, NumCal = 0, NumDea = 0;
+  FillZero(&WrkMat[16], InpEst, InpEst);
+  FillZero(&WrkMat[17], InpEst, InpObs);
+  FillZero(&WrkMat[18], InpObs, InpObs);
+  FillZero(&WrkMat[19], InpEst, InpObs);
+  TMatrixD* P = WrkMat[16];
+  TMatrixD* H = WrkMat[17];
+  TMatrixD* F = WrkMat[18];
+  TMatrixD* W = WrkMat[19];
+  Int_t*    IAct = new Int_t[InpEst];
+  Int_t     IDea = -1;
+  P->operator=(*CovI);
+  W->operator=(*Lam);
+  for(Int_t i = 0; i<InpEst; i++)IAct[i] = 1;
 
   while(NDeAct > 0){
     NDeAct = 0;
     // Store estimates i of observable n with negative weights
-    //printf("... Blue->SolvePosWei(): Lam \n"); Lam->Print();
+    //printf("... Blue->SolvePosWei(): W \n"); W->Print();
     for(Int_t n = 0; n<InpObs; n++){    
       //printf("... Blue->SolvePosWei(): Next Obs is %2i \n", IsWhichObs(n));
       for(Int_t i = 0; i<InpEst; i++){     
-	if(EstWhichObs(IsWhichEst(i)) == IsWhichObs(n)){
+	if(IAct[i] == 1 && EstWhichObs(IsWhichEst(i)) == IsWhichObs(n)){
 	  //printf("... Blue->SolvePosWei(): Next Est=%2i(%2i) determines Obs=%2i \n", 
 	  //	 i,IsWhichEst(i),IsWhichObs(n));
-	  if(Lam->operator()(i,n) < 0){
-	    IDeAct->operator()(NDeAct) = IsWhichEst(i);
+	  if(W->operator()(i,n) < 0){
+	    IDeAct->operator()(NumDea+NDeAct) = IsWhichEst(i);
 	    NDeAct = NDeAct + 1;
 	  }
 	}
       }
     }
-    // Now deactivate if needed and solve
+    // Now remove them from P and get the new weights
     if(NDeAct > 0){
-      ReleaseInp();
-      for(Int_t l = 0; l<NDeAct; l++){
-	NumDea = NumDea + 1;
-	SetInActiveEst(static_cast<int>(IDeAct->operator()(l)));
+      for(Int_t l = NumDea; l<NumDea+NDeAct; l++){
+	IDea = IsIndexEst(static_cast<int>(IDeAct->operator()(l)));
+	for(Int_t a = 0; a<InpEst; a++){
+	  for(Int_t b = 0; b<InpEst; b++){
+	    if(a != IDea && b != IDea){
+	      P->operator()(a,b) = P->operator()(a,b) - 
+		P->operator()(a,IDea) * P->operator()(IDea,b) / P->operator()(IDea,IDea);
+	    }
+	  }
+	}
+	for(Int_t a = 0; a<InpEst; a++){
+	  P->operator()(a,IDea) = 0;
+	  P->operator()(IDea,a) = 0;
+	}
+	IAct[IDea] = 0;
       }
+      NumDea = NumDea + NDeAct;
       NumCal = NumCal + 1;
-      FixInp();
-      Solve();
+      H->Mult(*P, *Uma);
+      F->Mult(*Utr, *H);
+      F->Invert();
+      W->Mult(*H, *F);
+    }
+  }
+  P = NULL;
+  H = NULL;
+  F = NULL;
+  W = NULL;
+  delete [] IAct; IAct = NULL;
+
+  // Fix and solve for the remaining estimates
+  if(NumDea > 0){
+    ReleaseInp();
+    for(Int_t l = 0; l<NumDea; l++){
+      SetInActiveEst(static_cast<int>(IDeAct->operator()(l)));
     }
+    FixInp();
+    Solve();
   }
   
   // Report the findings
@@ -1327,13 +1737,18 @@ void Blue::SolvePosWei(){
     printf("... Blue->SolvePosWei(): Not needed all weights are positive \n");
   }else{
     printf("... Blue->SolvePosWei(): Succcess after disabling %2i estimates in %2i iterations \n", NumDea, NumCal);
+    printf("... Blue->SolvePosWei(): The disabled estimates are:");
+    for(Int_t l = 0; l<NumDea; l++){
+      printf(" %2i", static_cast<int>(IDeAct->operator()(l)));
+    }
+    printf("\n");
   }
 
   // Set the flag
   SetIsSolvedPosWei(1);
 
   // Clean up
-  IDeAct->Delete(); IDeAct = NULL;
+  delete IDeAct; IDeAct = NULL;
 
   return;
 };
@@ -1402,8 +1817,8 @@ void Blue::SolveMaxVar(const Int_t IFuRho){
   //printf("... Blue->SolveMaxVar(%2i): VarMinEst = %5.3f \n",IFuRho,VarMinEst);
 
   // The variances before and after
-  VarMax->Delete(); VarMax = new TVectorD(InpObs);
-  VarMin->Delete(); VarMin = new TVectorD(InpObs);
+  FillZero(&VarMax, InpObs);
+  FillZero(&VarMin, InpObs);
   for(Int_t n = 0; n < InpObs; n++){
     VarMin->operator()(n) = CovRes->operator()(n,n);
     VarMax->operator()(n) = CovRes->operator()(n,n);
@@ -1412,13 +1827,13 @@ void Blue::SolveMaxVar(const Int_t IFuRho){
   //printf("... Blue->SolveMaxVar(%2i): VarMax \n",IFuRho); VarMax->Print();
 
   // The correlations before and after
-  RhoMax->Delete(); RhoMax = new TMatrixD(InpEst,InpEst);
-  RhoMin->Delete(); RhoMin = new TMatrixD(InpEst,InpEst);
+  FillZero(&RhoMax, InpEst, InpEst);
+  FillZero(&RhoMin, InpEst, InpEst);
   RhoMin->SetSub(0,0,*Rho);
   //printf("... Blue->SolveMaxVar(%2i): RhoMin \n",IFuRho); RhoMin->Print();
 
   // The correlations that equal 1/z
-  RhoOoz->Delete(); RhoOoz = new TMatrixD(InpEst,InpEst);
+  FillZero(&RhoOoz, InpEst, InpEst);
   for(Int_t i = 0; i < InpEst; i++){
     for(Int_t j = i+1; j < InpEst; j++){
       if(Rho->operator()(i,j) > 0){
@@ -1433,12 +1848,27 @@ void Blue::SolveMaxVar(const Int_t IFuRho){
 
   // The fijk values to fill for IFuFla=0/1/2
   // Need original dimensions
-  RhoFpk->Delete(); RhoFpk = new TVectorD(InpUncOrig);
-  RhoFij->Delete(); RhoFij = new TMatrixD(InpEstOrig,InpEstOrig);
+  FillZero(&RhoFpk, InpUncOrig);
+  FillZero(&RhoFij, InpEstOrig, InpEstOrig);
 
   // Set quiet modus
   SetQuiet(1);
 
+  // Only the factors change, without changed or reduced correlations combine
+  // the scan points via CalcScaRho() from the fixed input, with low rank
+  // updates w.r.t. the factors before each scan. For IFuFla = 2 each point
+  // only changes the correlation of one pair, i.e. it is a rank 2 update.
+  Int_t IScan = 1;
+  Double_t VarAct = 0;
+  TVectorD* SigPre = new TVectorD(InpObs);
+  for(Int_t k = 0; k<InpUncOrig; k++){    
+    if(IsActiveUnc(k) == 1){
+      if(IsRhoRedUnc(k) == 1 || IsRhoValUnc(k) == 1)IScan = 0;
+    }
+  }
+  CalcScaPre(SigPre);
+  FillSloWrk(1);
+
   // Loop over observables
   Double_t RhoFac = 1; 
   Double_t RhoLim = 0; 
@@ -1455,24 +1885,20 @@ void Blue::SolveMaxVar(const Int_t IFuRho){
       // Find the Fijk = F with MaxVar
       RhoFac = 1 - RhoDif;
       RhoFco = 1;
-      while(RhoFac >= RhoLim){
-	ReleaseInp();
-	//printf("... Blue->SolveMaxVar(%2i): RhoFac %5.3f \n",IFuRho,RhoFac);
-	for(Int_t k = 1; k<InpUncOrig; k++){if(IsActiveUnc(k))SetRhoFacUnc(k,RhoFac);};
-	FixInp();
-	Solve();
-	if(InspectResult() < 0){	  	  
-	  IFuFai[IFuFla] = IFuFai[IFuFla] + 1;	  
-	  if(IsPrintLevel() > 2){
-	    printf("... Blue->SolveMaxVar(%2i): Strange Covariance %2i %5.3f %12.9f \n",
-		   IFuRho,InspectResult(),RhoFac,CovRes->operator()(n,n));
+      if(IScan == 1 && IsLowRankScan() == 1)FillScaBase(ActFac, NULL);
+      if(TolMax > 0){
+	RhoFco = CalcMaxFac(n, -1, -1, RhoFco, &VarRun, IScan, SigPre);
+      }else{
+	while(RhoFac >= RhoLim){
+	  //printf("... Blue->SolveMaxVar(%2i): RhoFac %5.3f \n",IFuRho,RhoFac);
+	  VarAct = CalcMaxVar(n, -1, -1, RhoFac, IScan, SigPre);
+	  if(VarAct > VarRun){
+	    //printf("... Blue->SolveMaxVar(%2i): old %12.9f new %12.9f \n",IFuRho,VarRun,VarAct);
+	    VarRun = VarAct;
+	    RhoFco = RhoFac;
 	  }
-	}else if(CovRes->operator()(n,n) > VarRun){
-	  //printf("... Blue->SolveMaxVar(%2i): old %12.9f new %12.9f \n",IFuRho,VarRun,CovRes->operator()(n,n));
-	  VarRun = CovRes->operator()(n,n);
-	  RhoFco = RhoFac;
+	  RhoFac = RhoFac - RhoDif; 
 	}
-        RhoFac = RhoFac - RhoDif; 
       }
       // Set the RhoFco. Solve finally
       ReleaseInp();
@@ -1489,24 +1915,20 @@ void Blue::SolveMaxVar(const Int_t IFuRho){
 	if(IsActiveUnc(k)){
 	  RhoFac = 1 - RhoDif; 
 	  //printf("... Blue->SolveMaxVar(%2i): Next source  %2i \n",IFuRho,k);
-	  while(RhoFac >= RhoLim){
-	    //printf("... Blue->SolveMaxVar(%2i): RhoFac %5.3f \n",IFuRho,RhoFac);
-	    if(IsFixedInp() == 1)ReleaseInp();
-	    SetRhoFacUnc(k,RhoFac);
-	    FixInp();
-	    Solve();
-	    if(InspectResult() < 0){	  	  
-	      IFuFai[IFuFla] = IFuFai[IFuFla] + 1;	  
-	      if(IsPrintLevel() > 2){
-		printf("... Blue->SolveMaxVar(%2i): Strange Covariance %2i %2i %5.3f %12.9f \n",
-		       IFuRho,k,InspectResult(),RhoFac,CovRes->operator()(n,n));
+	  if(IScan == 1 && IsLowRankScan() == 1)FillScaBase(ActFac, NULL);
+	  if(TolMax > 0){
+	    RhoFpk->operator()(k) = CalcMaxFac(n, k, -1, RhoFpk->operator()(k), &VarRun, IScan, SigPre);
+	  }else{
+	    while(RhoFac >= RhoLim){
+	      //printf("... Blue->SolveMaxVar(%2i): RhoFac %5.3f \n",IFuRho,RhoFac);
+	      VarAct = CalcMaxVar(n, k, -1, RhoFac, IScan, SigPre);
+	      if(VarAct > VarRun){
+		//printf("... Blue->SolveMaxVar(%2i): old %12.9f new %12.9f \n",IFuRho,VarRun,VarAct);
+		VarRun = VarAct;
+		RhoFpk->operator()(k) = RhoFac;
 	      }
-	    }else if(CovRes->operator()(n,n) > VarRun){
-	      //printf("... Blue->SolveMaxVar(%2i): old %12.9f new %12.9f \n",IFuRho,VarRun,CovRes->operator()(n,n));
-	      VarRun = CovRes->operator()(n,n);
-	      RhoFpk->operator()(k) = RhoFac;
+	      RhoFac = RhoFac - RhoDif;
 	    }
-	    RhoFac = RhoFac - RhoDif;
 	  }
 	  // Reset Fk for this source
 	  ReleaseInp();
@@ -1528,8 +1950,13 @@ void Blue::SolveMaxVar(const Int_t IFuRho){
 	  SetFutchCor(i,j,1,RhoFac);
 	}
       }      
+      if(IScan == 1 && IsLowRankScan() == 1)FillScaBase(ActFac, RhoFij);
       // The indicies of active objects
-      Int_t ia = 0, ja = 0;
+      Int_t ia = 0, ja = 0, IRes = 0, IWoo = 0;
+      FillZero(&WrkMat[37], 1, InpObs);
+      FillZero(&WrkMat[38], 1, InpObs);
+      TMatrixD *ValMat = WrkMat[37];
+      TMatrixD *VarMat = WrkMat[38];
       //printf("... Blue->SolveMaxVar(%2i): RhoFij \n",IFuRho); RhoFij->Print();
       // Now optimize one by one
       for(Int_t i = 0; i<InpEstOrig; i++){
@@ -1539,35 +1966,42 @@ void Blue::SolveMaxVar(const Int_t IFuRho){
 	    if(IsActiveEst(j) == 1){
 	      RhoFac = 1 - RhoDif; 
 	      RhoSav = 1; 
-	      RhoTes = Rho->operator()(ia,ja);
-	      while(RhoFac >= RhoLim && RhoTes > 0){
-		if(IsFixedInp() == 1)ReleaseInp();
-		SetFutchCor(i,j,1,RhoFac);	  
-		//printf("... Blue->SolveMaxVar(%2i): RhoFij \n",IFuRho); RhoFij->Print();
-		FixInp();
-		Solve();
-		//printf("... Blue->SolveMaxVar(%2i): old %12.9f new %12.9f \n",IFuRho,VarRun,CovRes->operator()(n,n));
-		if(InspectResult() < 0){	  	  
-		  IFuFai[IFuFla] = IFuFai[IFuFla] + 1;	  
-		  if(IsPrintLevel() > 2){
-		    printf("... Blue->SolveMaxVar(%2i): Strange Covariance %2i %2i %2i %5.3f %12.9f \n",
-			   IFuRho,i,j,InspectResult(),RhoFac,CovRes->operator()(n,n));
+	      // The total correlation with the factors of the previous pairs
+	      RhoTes = 0;
+	      for(Int_t k = 0; k<InpUnc; k++){
+		RhoTes = RhoTes + Unc->operator()(ia+k*InpEst) * CalcScaCor(k, ia, ja, ActFac, RhoFij) * 
+		  Unc->operator()(ja+k*InpEst);
+	      }
+	      RhoTes = RhoTes / (Sig->operator()(ia) * Sig->operator()(ja));
+	      if(TolMax > 0 && RhoTes > 0){
+		RhoSav = CalcMaxFac(n, i, j, RhoSav, &VarRun, IScan, SigPre);
+	      }else{
+		while(RhoFac >= RhoLim && RhoTes > 0){
+		  VarAct = CalcMaxVar(n, i, j, RhoFac, IScan, SigPre);
+		  //printf("... Blue->SolveMaxVar(%2i): old %12.9f new %12.9f \n",IFuRho,VarRun,VarAct);
+		  if(VarAct > VarRun){
+		    VarRun = VarAct;
+		    RhoSav = RhoFac;
 		  }
-		}else if(CovRes->operator()(n,n) > VarRun){
-		  VarRun = CovRes->operator()(n,n);
-		  RhoSav = RhoFac;
+		  RhoFac = RhoFac - RhoDif;
 		}
-		RhoFac = RhoFac - RhoDif;
 	      }
-	      // Set the next achieved Fijk and Solve
-	      ReleaseInp();
+	      // Set the next achieved Fijk and move the base to it
+	      if(IsFixedInp() == 1)ReleaseInp();
 	      SetFutchCor(i,j,1,RhoSav);
-	      FixInp();
-	      Solve();
-	      VarRun = CovRes->operator()(n,n);
-	      if(InspectResult() < 0){
+	      if(IScan == 1){
+		IRes = CalcScaRho(ActFac, RhoFij, SigPre, 0, 0, ValMat, VarMat, &IWoo);
+		VarRun = VarMat->operator()(0,n);
+		if(IsLowRankScan() == 1)FillScaBase(ActFac, RhoFij);
+	      }else{
+		FixInp();
+		Solve();
+		IRes = InspectResult();
+		VarRun = CovRes->operator()(n,n);
+	      }
+	      if(IRes < 0){
 		printf("... Blue->SolveMaxVar(%2i): Strange Covariance at End %2i %2i %5.3f %12.9f \n",
-		       IFuRho,i,j,RhoFac,CovRes->operator()(n,n));
+		       IFuRho,i,j,RhoFac,VarRun);
 		printf("... Blue->SolveMaxVar: (%2i,%2i)=(%2i,%2i) In=%4.2f, Fac=%5.3f, Out=%4.2f, CovRes=%12.9f \n",
 		       i,j,ia,ja,RhoTes,RhoSav,RhoTes*RhoSav,VarRun);
 	      }
@@ -1577,6 +2011,13 @@ void Blue::SolveMaxVar(const Int_t IFuRho){
 	  ia = ia + 1;
 	}
       }
+      ValMat = NULL;
+      VarMat = NULL;
+      // Solve finally, a release would also reset the futch factors
+      if(IsFixedInp() == 0){
+	FixInp();
+	Solve();
+      }
     }
     VarMax->operator()(n) = CovRes->operator()(n,n);
     RhoMax->SetSub(0,0,*Rho);
@@ -1586,6 +2027,8 @@ void Blue::SolveMaxVar(const Int_t IFuRho){
   
   // Remove quiet modus and solve with the latest settings
   SetQuiet(0);
+  ScaBas = 0;
+  delete SigPre; SigPre = NULL;
   
   // Set the flag
   SetIsSolvedMaxVar(1);
@@ -1596,6 +2039,110 @@ void Blue::SolveMaxVar(const Int_t IFuRho){
   return;
 };
 
+//------------------------------------------------------------------------------
+
+void Blue::SolveSensitivity(){
+  if(IsFilledInp() == 0){
+    printf("... Blue->SolveSensitivity(): IGNORED Not all estimates/uncertainties filled IGNORED \n");
+    return;
+  }else if(IsFixedInp() == 0){
+    printf("... Blue->SolveSensitivity(): IGNORED Input not yet fixed call FixInp \n");
+    return;
+  }else if(IsSolvedSensit() == 1){
+    printf("... Blue->SolveSensitivity(): IGNORED Nothing changed since last call to this function.");
+    printf(" Call ReleaseInp() or ResetInp() \n");
+    return;
+  }else if(IsSolved() == 1){
+    printf("... Blue->SolveSensitivity(): IGNORED Two consecutive calls to Solve() are not supported.");
+    printf(" Call ReleaseInp() or ResetInp() \n");
+    return;
+  }
+
+  // Solve once
+  SetQuiet(1);
+  Solve();
+  SetQuiet(0);
+  if(IsSolved() != 1){
+    printf("... Blue->SolveSensitivity(): IGNORED Could not solve \n");
+    return;
+  }
+
+  // The derivatives of the combined values and their uncertainties, instead
+  // of a scan, from the solution for Cov = Sum_k Dk * Cork * Dk with Dk the
+  // diagonal matrix of the uncertainties sik of source k. For a change dCov
+  //   dXvaRes = - LamT * dCov * g,  with g = Cov-1 * (Xva - U * XvaRes)
+  //   dCovRes =   LamT * dCov * Lam
+  // and dSig(n) = dCovRes(n,n) / 2*Sig(n), with Sig(n) = sqrt(CovRes(n,n)).
+  // 1) The uncertainty sik of estimate i from source k, with wT the row i
+  //    of Cork * Dk, i.e. w the column i of Dk * Cork, changes
+  //    dCov = ei * wT + w * eiT. The matrix
+  //    Sk = Cork * Dk * (g, Lam) gives wT * g = Sk(i,0), wT * Lam(n) =
+  //    Sk(i,1+n) and all derivatives follow without any further products.
+  // 2) A common factor on all correlations of source k, as in SolveScaRho(),
+  //    changes dCov = Dk * (Cork - 1) * Dk, i.e. the sum over i of
+  //    sik * (Sk(i,.) - sik * (g, Lam)(i,.)) times (g, Lam)(i,.).
+  // ValSen[n](i,k) / ValSen[n](InpEst,k): dXvaRes(n) / dsik and dRhok
+  // SigSen[n](i,k) / SigSen[n](InpEst,k): dSig(n)    / dsik and dRhok
+  FillZero(&WrkMat[41], InpEst, 1+InpObs);
+  FillZero(&WrkMat[42], InpEst, 1+InpObs);
+  FillZero(&WrkMat[43], InpEst, 1+InpObs);
+  FillZero(&WrkMat[44], InpEst, 1);
+  TMatrixD *B = WrkMat[41];
+  TMatrixD *D = WrkMat[42];
+  TMatrixD *S = WrkMat[43];
+  TMatrixD *R = WrkMat[44];
+  for(Int_t i = 0; i<InpEst; i++){
+    R->operator()(i,0) = Xva->operator()(i);
+    for(Int_t n = 0; n<InpObs; n++){
+      R->operator()(i,0) = R->operator()(i,0) - Uma->operator()(i,n)*XvaRes->operator()(n);
+      B->operator()(i,1+n) = Lam->operator()(i,n);
+    }
+  }
+  for(Int_t i = 0; i<InpEst; i++){
+    for(Int_t j = 0; j<InpEst; j++){
+      B->operator()(i,0) = B->operator()(i,0) + CovI->operator()(i,j)*R->operator()(j,0);
+    }
+  }
+  for(Int_t n = 0; n<InpObs; n++){
+    FillZero(&ValSen[n], InpEst+1, InpUnc);
+    FillZero(&SigSen[n], InpEst+1, InpUnc);
+  }
+  Double_t Sik = 0, SigRes = 0;
+  for(Int_t k = 0; k<InpUnc; k++){
+    for(Int_t i = 0; i<InpEst; i++){
+      for(Int_t c = 0; c<=InpObs; c++){
+	D->operator()(i,c) = Unc->operator()(i+k*InpEst) * B->operator()(i,c);
+      }
+    }
+    S->Mult(*Cor[k], *D);
+    for(Int_t n = 0; n<InpObs; n++){
+      SigRes = TMath::Sqrt(CovRes->operator()(n,n));
+      for(Int_t i = 0; i<InpEst; i++){
+	Sik = Unc->operator()(i+k*InpEst);
+	ValSen[n]->operator()(i,k) = -(B->operator()(i,1+n) * S->operator()(i,0) + 
+				       S->operator()(i,1+n) * B->operator()(i,0));
+	SigSen[n]->operator()(i,k) = B->operator()(i,1+n) * S->operator()(i,1+n) / SigRes;
+	ValSen[n]->operator()(InpEst,k) = ValSen[n]->operator()(InpEst,k) - 
+	  Sik * B->operator()(i,1+n) * (S->operator()(i,0) - Sik * B->operator()(i,0));
+	SigSen[n]->operator()(InpEst,k) = SigSen[n]->operator()(InpEst,k) + 
+	  Sik * B->operator()(i,1+n) * (S->operator()(i,1+n) - Sik * B->operator()(i,1+n)) / (2*SigRes);
+      }
+    }
+  }
+  B = NULL;
+  D = NULL;
+  S = NULL;
+  R = NULL;
+
+  // Set the flag
+  SetIsSolvedSensit(1);
+
+  // Print out if wanted
+  if(IsPrintLevel() > 0)PrintSensitivity();
+
+  return;
+};
+
 //------------------------------------------------------------------------------
 // Filler
 //------------------------------------------------------------------------------
@@ -1624,10 +2171,9 @@ void Blue::FillEst(const Int_t i, const Double_t *x){
 	val = -1. * x[0] * x[k+1] / 100.;
       }
 
-      double* unc = &val;
       IRow=i+k*InpEst;
-      //printf("... Blue->FillEst: IRow = %2i, ICol = %2i, val = %5.3f \n",  IRow, IRow, x[k+1]);
-      Unc->InsertRow(IRow,IRow,unc,1);
+      //printf("... Blue->FillEst: IRow = %2i, val = %5.3f \n",  IRow, x[k+1]);
+      Unc->operator()(IRow) = val;
       // The sum
       sig = sig + val*val;
     }
@@ -1709,14 +2255,14 @@ void Blue::FillCor(const Int_t k, const Double_t *x){
       //F->Print();
     };
 
-    // Fill into local structures
-    Int_t IRow = kk*InpEst;
-    Int_t ICol = kk*InpEst;
-    Cor->SetSub(IRow,ICol,*F);
-    //Cor->Print();
+    // Fill into local structures and classify the matrix
+    Cor[kk]->operator=(*F);
+    //Cor[kk]->Print();
+    CorTyp[kk] = IsWhichMatrix(F);
+    if(CorTyp[kk] > 2)CorTyp[kk] = 2;
 
     // Cean up
-    F->Delete(); F = NULL;
+    delete F; F = NULL;
 
     // Set Flags
     SetActiveUnc(kk,1);
@@ -1748,12 +2294,14 @@ void Blue::FillCor(const Int_t k, const Double_t rho){
 	F->operator()(j,i) = rho;
       }
     }
-    Int_t IRow = k*InpEstOrig;
-    Cor->SetSub(IRow,IRow,*F);
-    //Cor->Print();
+    Cor[k]->operator=(*F);
+    //Cor[k]->Print();
+    CorTyp[k] = 2;
+    if(rho == 0.)CorTyp[k] = 0;
+    if(rho == 1.)CorTyp[k] = 1;
 
     // Cean up
-    F->Delete(); F = NULL;
+    delete F; F = NULL;
 
     // Set Flags
     SetActiveUnc(k,1);
@@ -2050,7 +2598,7 @@ Int_t Blue::GetCov(Double_t *RetCov)const{
     TMatrixD* Dumm = new TMatrixD(InpEst,InpEst);
     Int_t IRet = GetCov(Dumm);
     MatrixtoDouble(Dumm, RetCov);
-    Dumm->Delete(); Dumm = NULL;
+    delete Dumm; Dumm = NULL;
     return IRet;
   }
   printf("... Blue->GetCov: Presently not available, call FixInp() \n");
@@ -2082,7 +2630,7 @@ Int_t Blue::GetCovInvert(Double_t *RetCovI)const{
     TMatrixD* Dumm = new TMatrixD(InpEst,InpEst);
     Int_t IRet = GetCovInvert(Dumm);
     MatrixtoDouble(Dumm, RetCovI);
-    Dumm->Delete(); Dumm = NULL;
+    delete Dumm; Dumm = NULL;
     return IRet;
   }
   printf("... Blue->GetCovInvert: Presently not available, call FixInp() \n");
@@ -2114,7 +2662,7 @@ Int_t Blue::GetRho(Double_t *RetRho)const{
     TMatrixD* Dumm = new TMatrixD(InpEst,InpEst);
     Int_t IRet = GetRho(Dumm);
     MatrixtoDouble(Dumm, RetRho);
-    Dumm->Delete(); Dumm = NULL;
+    delete Dumm; Dumm = NULL;
     return IRet;
   }
   printf("... Blue->GetRho: Presently not available, call FixInp() \n");
@@ -2135,7 +2683,7 @@ Int_t Blue::GetEst(TMatrixD *UseEst)const{
     for(Int_t i = 0; i<InpEst; i++){
       UseEst->operator()(i,0) = Xva->operator()(i);
       for(Int_t k = 0; k<InpUnc; k++){
-	UseEst->operator()(i,k+1) = Unc->operator()(i+k*InpEst,i+k*InpEst);
+	UseEst->operator()(i,k+1) = Unc->operator()(i+k*InpEst);
       }
     }
     //UseEst->Print();
@@ -2156,7 +2704,7 @@ Int_t Blue::GetEst(Double_t *RetEst)const{
     TMatrixD* Dumm = new TMatrixD(InpEst,InpUnc+1);
     Int_t IRet = GetEst(Dumm);
     MatrixtoDouble(Dumm, RetEst);
-    Dumm->Delete(); Dumm = NULL;
+    delete Dumm; Dumm = NULL;
     return IRet;
   }
   printf("... Blue->GetEst: Presently not available, call FixInp() \n");
@@ -2253,7 +2801,7 @@ Int_t Blue::GetParams(const Int_t Ifl, TMatrixD *UseParams) const {
 	ii = ii + 1;
       }
     }
-    Dumm->Delete(); Dumm = NULL;
+    delete Dumm; Dumm = NULL;
     return 1;
   }else{
     printf("... Blue->GetParams(%2i): Presently not available, call FixInp() \n",Ifl);
@@ -2268,7 +2816,7 @@ Int_t Blue::GetParams(const Int_t Ifl, Double_t *RetParams) const{
   TMatrixD* Dumm = new TMatrixD(InpEst,InpEst);
   Int_t IRet = GetParams(Ifl, Dumm);
   MatrixtoDouble(Dumm, RetParams);
-  Dumm->Delete(); Dumm = NULL;
+  delete Dumm; Dumm = NULL;
   return IRet;
 };
 
@@ -2362,7 +2910,7 @@ Int_t Blue::GetCovRes(Double_t *RetCovRes)const{
     TMatrixD* Dumm = new TMatrixD(InpObs,InpObs);
     Int_t IRet = GetCovRes(Dumm);
     MatrixtoDouble(Dumm, RetCovRes);
-    Dumm->Delete(); Dumm = NULL;
+    delete Dumm; Dumm = NULL;
     return IRet;
   }
   printf("... Blue->GetCovRes: Presently not available, call Solve() \n");
@@ -2394,7 +2942,7 @@ Int_t Blue::GetRhoRes(Double_t *RetRhoRes)const{
     TMatrixD* Dumm = new TMatrixD(InpObs,InpObs);
     Int_t IRet = GetRhoRes(Dumm);
     MatrixtoDouble(Dumm, RetRhoRes);
-    Dumm->Delete(); Dumm = NULL;
+    delete Dumm; Dumm = NULL;
     return IRet;
   }
   printf("... Blue->GetRhoRes: Presently not available, call Solve() \n");
@@ -2426,7 +2974,7 @@ Int_t Blue::GetWeight(Double_t *RetWeight)const{
     TMatrixD* Dumm = new TMatrixD(InpEst,InpObs);
     Int_t IRet = GetWeight(Dumm);
     MatrixtoDouble(Dumm, RetWeight);
-    Dumm->Delete(); Dumm = NULL;
+    delete Dumm; Dumm = NULL;
     return IRet;
   }
   printf("... Blue->GetWeight: Presently not available, call Solve() \n");
@@ -2467,7 +3015,7 @@ Int_t Blue::GetResult(Double_t *RetResult)const{
     TMatrixD* Dumm = new TMatrixD(InpObs,InpUnc+1);
     Int_t IRet = GetResult(Dumm);
     MatrixtoDouble(Dumm, RetResult);
-    Dumm->Delete(); Dumm = NULL;
+    delete Dumm; Dumm = NULL;
     return IRet;
   }
   printf("... Blue->GetResult: Presently not available, call Solve() \n");
@@ -2505,7 +3053,7 @@ Int_t Blue::GetUncert(Double_t *RetUncert)const{
     TMatrixD* Dumm = new TMatrixD(InpObs,1);
     Int_t IRet = GetUncert(Dumm);
     MatrixtoDouble(Dumm, RetUncert);
-    Dumm->Delete(); Dumm = NULL;
+    delete Dumm; Dumm = NULL;
     return IRet;
   }
   printf("... Blue->GetUncert: Presently not available, call Solve() \n");
@@ -2514,6 +3062,89 @@ Int_t Blue::GetUncert(Double_t *RetUncert)const{
 
 //------------------------------------------------------------------------------
 
+Int_t Blue::GetResultVar(const TMatrixD *InpVal, TMatrixD *UseResVal, 
+			 TMatrixD *UsePulVal, Double_t *RetChiVal)const{
+  // Re-combine NumVar variations of the central values with the weights of
+  // Solve(), e.g. for shifted, blinded or re-weighted estimates, without
+  // touching the solved object. The uncertainties stay the ones of Solve(),
+  // i.e. relative uncertainties are not re-evaluated at the new values.
+  // InpVal(i,v):    Value of estimate i (as in FillEst) for variation v
+  // UseResVal(n,v): Combined value of active observable n
+  // UsePulVal(i,v): Pull of active estimate i, may be NULL
+  // RetChiVal[v]:   Chi squared of variation v, may be NULL
+  // For all columns at once this is XvaRes = LamT * X and the chi squared
+  // the column sums of (X - U*XvaRes) x (Cov-1 * (X - U*XvaRes)).
+  if(IsSolved() == 0){
+    printf("... Blue->GetResultVar: Presently not available, call Solve() \n");
+    return 0;
+  }
+  Int_t NumVar = InpVal->GetNcols();
+  if(InpVal->GetNrows() != InpEstOrig){
+    printf("... Blue->GetResultVar: IGNORED I expect %2i rows of values \n", InpEstOrig);
+    return 0;
+  }else if(UseResVal->GetNrows() != InpObs || UseResVal->GetNcols() != NumVar){
+    printf("... Blue->GetResultVar: IGNORED I expect a %2i x %2i matrix for the results \n",
+	   InpObs, NumVar);
+    return 0;
+  }else if(UsePulVal != NULL && (UsePulVal->GetNrows() != InpEst || UsePulVal->GetNcols() != NumVar)){
+    printf("... Blue->GetResultVar: IGNORED I expect a %2i x %2i matrix for the pulls \n",
+	   InpEst, NumVar);
+    return 0;
+  }
+  if(IsPrintLevel() >= 1){
+    printf("... Blue->GetResultVar: Return the results for %4i variations as TMatrixD \n", NumVar);
+  }
+
+  // The active estimates and the weights
+  TMatrixD *X = new TMatrixD(InpEst,NumVar);
+  TMatrixD *T = new TMatrixD(InpObs,InpEst);
+  for(Int_t i = 0; i<InpEst; i++){
+    for(Int_t v = 0; v<NumVar; v++){
+      X->operator()(i,v) = InpVal->operator()(IsWhichEst(i),v);
+    }
+  }
+  T->Transpose(*Lam);
+  UseResVal->Mult(*T, *X);
+
+  // The residuals, their pulls and the chi squared
+  if(UsePulVal != NULL || RetChiVal != NULL){
+    TMatrixD *R = new TMatrixD(InpEst,NumVar);
+    TMatrixD *W = new TMatrixD(InpEst,NumVar);
+    W->Mult(*Uma, *UseResVal);
+    R->operator=(*X);
+    R->operator-=(*W);
+    if(UsePulVal != NULL){
+      Double_t unc = 0;
+      for(Int_t i = 0; i<InpEst; i++){
+	unc = 0;
+	for(Int_t n = 0; n<InpObs; n++){
+	  unc = unc + Uma->operator()(i,n)*CovRes->operator()(n,n);
+	}
+	unc = sqrt(Sig->operator()(i) * Sig->operator()(i) - unc);
+	for(Int_t v = 0; v<NumVar; v++){
+	  UsePulVal->operator()(i,v) = R->operator()(i,v) / unc;
+	}
+      }
+    }
+    if(RetChiVal != NULL){
+      W->Mult(*CovI, *R);
+      for(Int_t v = 0; v<NumVar; v++){
+	RetChiVal[v] = 0;
+	for(Int_t i = 0; i<InpEst; i++){
+	  RetChiVal[v] = RetChiVal[v] + R->operator()(i,v) * W->operator()(i,v);
+	}
+      }
+    }
+    delete R; R = NULL;
+    delete W; W = NULL;
+  }
+  delete X; X = NULL;
+  delete T; T = NULL;
+  return 1;
+};
+
+//------------------------------------------------------------------------------
+
 Int_t Blue::GetInspectLike(TMatrixD *UseInsLik)const{
   if(IsInspectedLike() == 1){
     if(IsPrintLevel() >= 1){
@@ -2537,13 +3168,56 @@ Int_t Blue::GetInspectLike(Double_t *RetInsLik)const{
     TMatrixD* Dumm = new TMatrixD(InpObsOrig,LikDim);
     Int_t IRet = GetInspectLike(Dumm);
     MatrixtoDouble(Dumm, RetInsLik);
-    Dumm->Delete(); Dumm = NULL;
+    delete Dumm; Dumm = NULL;
     return IRet;
   }
   printf("... Blue->GetInspectLike: Presently not available, call InspectLike() \n");
   return 0;
 };
 
+//------------------------------------------------------------------------------
+
+Int_t Blue::GetInspectToys(TMatrixD *UseInsToy)const{
+  if(IsInspectedToys() == 1){
+    if(IsPrintLevel() >= 1){
+      printf("... Blue->GetInspectToys: Return the results from InspectToys() as TMatrixD \n");  
+    }
+    UseInsToy->SetSub(0,0,*ToyRes);
+    return 1;
+  }
+  printf("... Blue->GetInspectToys: Presently not available, call InspectToys() \n");
+  return 0;
+};
+
+//------------------------------------------------------------------------------
+
+Int_t Blue::GetToysPulHis(TMatrixD *UsePulHis)const{
+  if(IsInspectedToys() == 1){
+    if(IsPrintLevel() >= 1){
+      printf("... Blue->GetToysPulHis: Return the pull histograms from InspectToys() as TMatrixD \n");  
+    }
+    UsePulHis->SetSub(0,0,*ToyPul);
+    return 1;
+  }
+  printf("... Blue->GetToysPulHis: Presently not available, call InspectToys() \n");
+  return 0;
+};
+
+//------------------------------------------------------------------------------
+
+Int_t Blue::GetToysProHis(TMatrixD *UseProHis)const{
+  if(IsInspectedToys() == 1){
+    if(IsPrintLevel() >= 1){
+      printf("... Blue->GetToysProHis: Return the chi squared probability histogram from");
+      printf(" InspectToys() as TMatrixD \n");  
+    }
+    UseProHis->SetSub(0,0,*ToyPro);
+    return 1;
+  }
+  printf("... Blue->GetToysProHis: Presently not available, call InspectToys() \n");
+  return 0;
+};
+
 //------------------------------------------------------------------------------
 // After SolveXXX()
 
@@ -2592,18 +3266,69 @@ Int_t Blue::GetAccImpIndEst(const Int_t n, Int_t *IndEst) const{
   }
   return 0;
 };
-  
+
 //------------------------------------------------------------------------------
 
-Int_t Blue::GetNumScaFac()const{
-  if(IsFixedInp() == 1){
+Int_t Blue::GetNumRelUnc() const{
+  if(IsSolvedRelUnc() == 1){
     if(IsPrintLevel() >= 1){
-      printf("... Blue->GetNumScaFac(): Return the number of groups for SolveScaRho() \n");
+      printf("... Blue->GetNumRelUnc(): Return the number of iterations of SolveRelUnc() \n");
     }
-    return InpFac;
-  }else{    
-    printf("... Blue->GetNumScaFac(): Presently not available, call FixInp() \n");
-    return 0;
+    return NumRel;
+  }
+  printf("... Blue->GetNumRelUnc(): Presently not available, call SolveRelUnc() \n");
+  return 0;
+};
+
+//------------------------------------------------------------------------------
+
+Int_t Blue::GetRelUncHis(TMatrixD *UseRelHis) const{
+  // Row l = 0,...,GetNumRelUnc() are the combined values of the active 
+  // observables after iteration l, l = 0 is the start value
+  if(IsSolvedRelUnc() == 1){
+    if(IsPrintLevel() >= 1){
+      printf("... Blue->GetRelUncHis(): Return the values per iteration of SolveRelUnc() as TMatrixD \n");
+    }
+    for(Int_t l = 0; l<NumRel+1; l++){
+      for(Int_t n = 0; n<InpObs; n++){
+	UseRelHis->operator()(l,n) = HisRel->operator()(l,n);
+      }
+    }
+    return 1;
+  }
+  printf("... Blue->GetRelUncHis(): Presently not available, call SolveRelUnc() \n");
+  return 0;
+};
+
+//------------------------------------------------------------------------------
+
+Int_t Blue::GetRelUncHis(Double_t *RetRelHis) const{
+  if(IsSolvedRelUnc() == 1){
+    if(IsPrintLevel() >= 1){
+      printf("... Blue->GetRelUncHis(): Return the values per iteration of SolveRelUnc() as Double_t array \n");
+    }
+    // The matrix version is the master
+    TMatrixD* Dumm = new TMatrixD(NumRel+1,InpObs);
+    Int_t IRet = GetRelUncHis(Dumm);
+    MatrixtoDouble(Dumm, RetRelHis);
+    delete Dumm; Dumm = NULL;
+    return IRet;
+  }
+  printf("... Blue->GetRelUncHis(): Presently not available, call SolveRelUnc() \n");
+  return 0;
+};
+  
+//------------------------------------------------------------------------------
+
+Int_t Blue::GetNumScaFac()const{
+  if(IsFixedInp() == 1){
+    if(IsPrintLevel() >= 1){
+      printf("... Blue->GetNumScaFac(): Return the number of groups for SolveScaRho() \n");
+    }
+    return InpFac;
+  }else{    
+    printf("... Blue->GetNumScaFac(): Presently not available, call FixInp() \n");
+    return 0;
   }
 };
 
@@ -2623,6 +3348,37 @@ Int_t Blue::GetNumScaRho()const{
 
 //------------------------------------------------------------------------------
 
+Int_t Blue::GetNumThreads()const{
+  if(IsPrintLevel() >= 1){
+    printf("... Blue->GetNumThreads(): Return the number of threads for SolveScaRho() \n");
+  }
+  return NumThr;
+};
+
+//------------------------------------------------------------------------------
+
+Int_t Blue::GetNumAlloc()const{
+  if(IsPrintLevel() >= 1){
+    printf("... Blue->GetNumAlloc(): Return the number of allocations of the workspace \n");
+  }
+  Int_t NumAlo = NumAll;
+  for(Int_t q = 0; q<SloMax; q++)NumAlo = NumAlo + SloAll[q];
+  return NumAlo;
+};
+
+//------------------------------------------------------------------------------
+
+Long64_t Blue::GetMemory()const{
+  if(IsPrintLevel() >= 1){
+    printf("... Blue->GetMemory(): Return the approximate memory of this object in bytes \n");
+  }
+  Long64_t MemSum = sizeof(Blue);
+  for(Int_t g = 0; g<MemGrp; g++)MemSum = MemSum + CalcMemory(g);
+  return MemSum;
+};
+
+//------------------------------------------------------------------------------
+
 Int_t Blue::GetScaVal(const Int_t n, TMatrixD *UseScaVal)const{
   if(IsSolvedScaRho() == 1){
     if(IsPrintLevel() >= 1){
@@ -2651,7 +3407,7 @@ Int_t Blue::GetScaVal(const Int_t n, Double_t *RetScaVal)const{
     TMatrixD* Dumm = new TMatrixD(InpUnc*InpFac,InrFac);
     Int_t IRet = GetScaVal(n,Dumm);
     MatrixtoDouble(Dumm, RetScaVal);
-    Dumm->Delete(); Dumm = NULL;
+    delete Dumm; Dumm = NULL;
     return IRet;
   }
   printf("... Blue->GetScaVal(%2i): Presently not available, call SolveScaRho() \n", n);
@@ -2688,13 +3444,230 @@ Int_t Blue::GetScaUnc(const Int_t n, Double_t *RetScaUnc)const{
     TMatrixD* Dumm = new TMatrixD(InpUnc*InpFac,InrFac);
     Int_t IRet = GetScaUnc(n,Dumm);
     MatrixtoDouble(Dumm, RetScaUnc);
-    Dumm->Delete(); Dumm = NULL;
+    delete Dumm; Dumm = NULL;
     return IRet;
   }
   printf("... Blue->GetScaUnc(%2i): Presently not available, call SolveScaRho() \n", n);
   return 0;
 };
 
+//------------------------------------------------------------------------------
+
+Int_t Blue::GetSenVal(const Int_t n, TMatrixD *UseSenVal)const{
+  if(IsSolvedSensit() == 1){
+    if(IsPrintLevel() >= 1){
+      printf("... Blue->GetSenVal(%2i): Return the values from SolveSensitivity() as TMatrixD \n", n);
+    }
+    if(IsActiveObs(n) == 1){
+      UseSenVal->SetSub(0,0,*ValSen[IsIndexObs(n)]);
+      return 1;
+    }else{
+      printf("... Blue->GetSenVal(%2i): %2i is not an active observable \n", n, n);
+      return 0;
+    }
+  }
+  printf("... Blue->GetSenVal(%2i): Presently not available, call SolveSensitivity() \n", n);
+  return 0;
+};
+
+//------------------------------------------------------------------------------
+
+Int_t Blue::GetSenVal(const Int_t n, Double_t *RetSenVal)const{
+  if(IsSolvedSensit() == 1){
+    if(IsPrintLevel() >= 1){
+      printf("... Blue->GetSenVal(%2i): Return the values from SolveSensitivity() as Double_t array \n", n);
+    }
+    // The matrix version is the master
+    TMatrixD* Dumm = new TMatrixD(InpEst+1,InpUnc);
+    Int_t IRet = GetSenVal(n,Dumm);
+    MatrixtoDouble(Dumm, RetSenVal);
+    delete Dumm; Dumm = NULL;
+    return IRet;
+  }
+  printf("... Blue->GetSenVal(%2i): Presently not available, call SolveSensitivity() \n", n);
+  return 0;
+};
+
+//------------------------------------------------------------------------------
+
+Int_t Blue::GetSenUnc(const Int_t n, TMatrixD *UseSenUnc)const{
+  if(IsSolvedSensit() == 1){
+    if(IsPrintLevel() >= 1){
+      printf("... Blue->GetSenUnc(%2i): Return the values from SolveSensitivity() as TMatrixD \n", n);
+    }
+    if(IsActiveObs(n) == 1){
+      UseSenUnc->SetSub(0,0,*SigSen[IsIndexObs(n)]);
+      return 1;
+    }else{
+      printf("... Blue->GetSenUnc(%2i): %2i is not an active observable \n", n, n);
+      return 0;
+    }
+  }
+  printf("... Blue->GetSenUnc(%2i): Presently not available, call SolveSensitivity() \n", n);
+  return 0;
+};
+
+//------------------------------------------------------------------------------
+
+Int_t Blue::GetSenUnc(const Int_t n, Double_t *RetSenUnc)const{
+  if(IsSolvedSensit() == 1){
+    if(IsPrintLevel() >= 1){
+      printf("... Blue->GetSenUnc(%2i): Return the values from SolveSensitivity() as Double_t array \n", n);
+    }
+    // The matrix version is the master
+    TMatrixD* Dumm = new TMatrixD(InpEst+1,InpUnc);
+    Int_t IRet = GetSenUnc(n,Dumm);
+    MatrixtoDouble(Dumm, RetSenUnc);
+    delete Dumm; Dumm = NULL;
+    return IRet;
+  }
+  printf("... Blue->GetSenUnc(%2i): Presently not available, call SolveSensitivity() \n", n);
+  return 0;
+};
+
+//------------------------------------------------------------------------------
+
+Int_t Blue::GetDerivative(const Int_t IWhat, const Int_t i, const Int_t k, TMatrixD *UseDer)const{
+  // The exact derivatives of the results w.r.t. one input, by running the
+  // solution on BlueDual, for the original indices
+  //   IWhat = 0: the value of estimate i, k is not used
+  //   IWhat = 1: the uncertainty of estimate i from source k
+  //   IWhat = 2: the factor l = i of source k of SetRhoFacUnc(k,l,RhoFac),
+  //              or the value l = i of source k of SetRhoValUnc(k,l,RhoVal)
+  // UseDer(n,0) = dXvaRes(n), UseDer(n,1+k) = dUncRes(n) from the active
+  // source k, and UseDer(n,InpUnc+1) = dSig(n) the total one
+  if(IsSolved() == 0){
+    printf("... Blue->GetDerivative(%2i,%2i,%2i): Presently not available, call Solve() \n", IWhat, i, k);
+    return 0;
+  }else if(IsPosDefCov() == 0){
+    printf("... Blue->GetDerivative(%2i,%2i,%2i): IGNORED Covariance not positive definite \n", IWhat, i, k);
+    return 0;
+  }
+  if(IWhat == 0){
+    if(IsActiveEst(i) == 0){
+      printf("... Blue->GetDerivative(%2i,%2i,%2i): IGNORED %2i is not an active estimate \n", IWhat, i, k, i);
+      return 0;
+    }
+  }else if(IWhat == 1){
+    if(IsActiveEst(i) == 0 || IsActiveUnc(k) == 0){
+      printf("... Blue->GetDerivative(%2i,%2i,%2i): IGNORED Not an active estimate or uncertainty \n", IWhat, i, k);
+      return 0;
+    }
+  }else if(IWhat == 2){
+    if(IsActiveUnc(k) == 0 || i < 0 || i >= InpFac){
+      printf("... Blue->GetDerivative(%2i,%2i,%2i): IGNORED Not an active uncertainty or group \n", IWhat, i, k);
+      return 0;
+    }else if(IsRhoFacUnc(k) == 0 && IsRhoValUnc(k) == 0){
+      printf("... Blue->GetDerivative(%2i,%2i,%2i): IGNORED Source not scaled or changed,", IWhat, i, k);
+      printf(" call SetRhoFacUnc() or SetRhoValUnc() \n");
+      return 0;
+    }
+  }else{
+    printf("... Blue->GetDerivative(%2i,%2i,%2i): IGNORED Not a valid choice \n", IWhat, i, k);
+    return 0;
+  }
+  if(IsPrintLevel() >= 1){
+    printf("... Blue->GetDerivative(%2i,%2i,%2i): Return the derivatives as TMatrixD \n", IWhat, i, k);
+  }
+
+  // The present input with the derivative seeded
+  std::vector<BlueDual> X(InpEst), S(InpEst*InpUnc), C(InpUnc*InpEst*InpEst);
+  std::vector<BlueDual> XRes(InpObs), URes(InpObs*(InpUnc+1));
+  std::vector<Double_t> U(InpEst*InpObs);
+  for(Int_t ia = 0; ia<InpEst; ia++){
+    X[ia] = BlueDual(Xva->operator()(ia));
+    for(Int_t n = 0; n<InpObs; n++)U[ia*InpObs+n] = Uma->operator()(ia,n);
+  }
+  for(Int_t ka = 0; ka<InpUnc; ka++){
+    for(Int_t ia = 0; ia<InpEst; ia++){
+      S[ia+ka*InpEst] = BlueDual(Unc->operator()(ia+ka*InpEst));
+      for(Int_t ja = 0; ja<InpEst; ja++){
+	C[ka*InpEst*InpEst+ia*InpEst+ja] = BlueDual(Cor[ka]->operator()(ia,ja));
+      }
+    }
+  }
+  if(IWhat == 0){
+    X[IsIndexEst(i)].Der = 1;
+  }else if(IWhat == 1){
+    S[IsIndexEst(i)+IsIndexUnc(k)*InpEst].Der = 1;
+  }else{
+    // The derivative of the working correlation of FixInp(), which is
+    // 1) the changed value or 2) the original one times the factor, then
+    // times the futch factor. The reduced correlations of SetRhoRedUnc()
+    // exclude both, see SetRhoFacUnc()
+    Int_t ka = IsIndexUnc(k), ii, jj;
+    Double_t Rhoij;
+    for(Int_t ia = 0; ia<InpEst; ia++){
+      for(Int_t ja = ia+1; ja<InpEst; ja++){
+	ii = IsWhichEst(ia);
+	jj = IsWhichEst(ja);
+	if(static_cast<int>(MatFac->operator()(ii,jj)) != i)continue;
+	if(IsRhoValUnc(k) == 1){
+	  Rhoij = 1;
+	}else{
+	  Rhoij = CorOrig[k]->operator()(ii,jj);
+	}
+	if(IsFutchCor() == 1 && k > 0)Rhoij = Rhoij * RhoFij->operator()(ii,jj);
+	C[ka*InpEst*InpEst+ia*InpEst+ja].Der = Rhoij;
+	C[ka*InpEst*InpEst+ja*InpEst+ia].Der = Rhoij;
+      }
+    }
+  }
+
+  // Solve
+  if(BlueCore(InpEst, InpObs, InpUnc, &X[0], &S[0], &C[0], &U[0], &XRes[0], &URes[0]) == 0){
+    printf("... Blue->GetDerivative(%2i,%2i,%2i): IGNORED Could not solve \n", IWhat, i, k);
+    return 0;
+  }
+
+  // The values of the core must reproduce the ones of Solve(), otherwise
+  // the derivatives belong to a different combination. Source -1 is the
+  // value, source InpUnc the total uncertainty
+  const Double_t TolCor = 1.E-8;
+  Double_t ValSol = 0, ValCor = 0;
+  for(Int_t n = 0; n<InpObs; n++){
+    for(Int_t ka = -1; ka<=InpUnc; ka++){
+      if(ka == -1){
+	ValSol = XvaRes->operator()(n);
+	ValCor = XRes[n].Val;
+      }else if(ka == InpUnc){
+	ValSol = TMath::Sqrt(CovRes->operator()(n,n));
+	ValCor = URes[n*(InpUnc+1)+ka].Val;
+      }else{
+	ValSol = CorRes->operator()(ka*InpObs+n,ka*InpObs+n);
+	ValCor = URes[n*(InpUnc+1)+ka].Val;
+      }
+      if(!(TMath::Abs(ValCor-ValSol) <= TolCor * TMath::Max(1., TMath::Abs(ValSol)))){
+	printf("... Blue->GetDerivative(%2i,%2i,%2i): IGNORED Core and Solve() disagree", IWhat, i, k);
+	printf(" for observable %2i, source %2i: %+12.6e != %+12.6e \n", n, ka, ValCor, ValSol);
+	return 0;
+      }
+    }
+  }
+
+  for(Int_t n = 0; n<InpObs; n++){
+    UseDer->operator()(n,0) = XRes[n].Der;
+    for(Int_t ka = 0; ka<=InpUnc; ka++){
+      UseDer->operator()(n,1+ka) = URes[n*(InpUnc+1)+ka].Der;
+    }
+  }
+  return 1;
+};
+
+//------------------------------------------------------------------------------
+
+Int_t Blue::GetDerivative(const Int_t IWhat, const Int_t i, const Int_t k, Double_t *RetDer)const{
+  if(IsPrintLevel() >= 1){
+    printf("... Blue->GetDerivative(%2i,%2i,%2i): Return the derivatives as Double_t array \n", IWhat, i, k);
+  }
+  // The matrix version is the master
+  TMatrixD* Dumm = new TMatrixD(InpObs,InpUnc+2);
+  Int_t IRet = GetDerivative(IWhat, i, k, Dumm);
+  if(IRet == 1)MatrixtoDouble(Dumm, RetDer);
+  delete Dumm; Dumm = NULL;
+  return IRet;
+};
+
 //------------------------------------------------------------------------------
 // Setters
 //------------------------------------------------------------------------------
@@ -2982,7 +3955,7 @@ void Blue::SetRelUnc(const Int_t k){
       for(Int_t i = 0; i<InpEstOrig; i++){	
 	if(IsActiveEst(i) == 1){
 	  Value = XvaOrig->operator()(i);
-	  Uncer = UncOrig->operator()(k*InpEstOrig+i, k*InpEstOrig+i);
+	  Uncer = UncOrig->operator()(k*InpEstOrig+i);
 	  if(k == 0){
 	    ActCof[1] = (Uncer*Uncer) / (TMath::Abs(Value));
 	    ActCof[2] = 0;
@@ -3097,6 +4070,93 @@ void Blue::SetNotRelUnc(const Int_t k){
   }
 };
 
+//------------------------------------------------------------------------------
+
+void Blue::SetNumThreads(const Int_t n){
+  if(n < 1){
+    printf("... Blue->SetNumThreads(%2i): IGNORED At least one thread is needed \n", n);
+    return;
+  }
+#ifdef Blue_IMT
+  NumThr = n;
+#else
+  NumThr = 1;
+  if(n > 1){
+    printf("... Blue->SetNumThreads(%2i): ROOT without multi-threading, I use one thread \n", n);
+    return;
+  }
+#endif
+  if(IsPrintLevel() >= 1){
+    printf("... Blue->SetNumThreads(%2i): I use %2i threads for the scans \n", n, NumThr);
+  }
+  return;
+};
+
+//------------------------------------------------------------------------------
+
+void Blue::SetLowRankScan(){
+  if(IsPrintLevel() >= 1){
+    printf("... Blue->SetLowRankScan(): Scans of correlations use low rank updates \n");
+  }
+  SetLowRankScan(1);
+};
+
+//------------------------------------------------------------------------------
+
+void Blue::SetNotLowRankScan(){
+  if(IsPrintLevel() >= 1){
+    printf("... Blue->SetNotLowRankScan(): Scans of correlations are solved in full \n");
+  }
+  SetLowRankScan(0);
+};
+
+//------------------------------------------------------------------------------
+
+void Blue::SetThreadSafe(){
+  // In thread-safe mode instances can be constructed and solved in parallel
+  // threads, one instance per thread, and the const functions of one instance
+  // can be called from several threads. Therefore:
+  // 1) The constructor does not touch the ROOT style, see SetupRoot().
+  // 2) No figures are made, which need gROOT for the TF1, TH1F and TCanvas
+  //    names, i.e. DrawSens() and the figures of InspectPair() are IGNORED,
+  //    and PrintCompatEst(), PrintScaRho() and InspectLike() only print.
+  // All computations only write to the members of their own instance, the
+  // likelihood of InspectLike() is evaluated without any TF1.
+  printf("... Blue->SetThreadSafe(): No figures and no ROOT style are made \n");
+  IThrSaf = 1;
+};
+
+//------------------------------------------------------------------------------
+
+void Blue::SetNotThreadSafe(){
+  printf("... Blue->SetNotThreadSafe(): Figures are made if wanted \n");
+  IThrSaf = 0;
+};
+
+//------------------------------------------------------------------------------
+
+Int_t Blue::IsThreadSafe(){
+  return IThrSaf;
+};
+
+//------------------------------------------------------------------------------
+
+void Blue::SetTolMaxVar(const Double_t Tol){
+  if(Tol < 0 || Tol >= 0.1){
+    printf("... Blue->SetTolMaxVar(%5.3e): IGNORED Only 0 <= Tol < 0.1 allowed \n", Tol);
+    return;
+  }
+  TolMax = Tol;
+  if(IsPrintLevel() >= 1){
+    if(TolMax > 0){
+      printf("... Blue->SetTolMaxVar(%5.3e): SolveMaxVar() searches the factors to this precision \n", Tol);
+    }else{
+      printf("... Blue->SetTolMaxVar(%5.3e): SolveMaxVar() scans the factors in steps of 0.01 \n", Tol);
+    }
+  }
+  return;
+};
+
 //---------------------------------------------------------------------------
 // Control Printout
 //---------------------------------------------------------------------------
@@ -3205,7 +4265,7 @@ void Blue::PrintDouble(const Double_t *TryDou, const Int_t NumRow, const Int_t N
     printf("... Blue->PrintDouble(): I will let PrintMatrix() do the job \n");
   }
   PrintMatrix(TryMat,NumRow,NumCol,ForVal);
-  TryMat->Delete(); TryMat = NULL;
+  delete TryMat; TryMat = NULL;
   return;
 };
 
@@ -3310,9 +4370,9 @@ void Blue::PrintEst(const Int_t i) const {
 	if(InpUnc > 1){
 	  for(Int_t k = 0; k<InpUnc; k++){
 	    if(k == 0){
-	      printf(" (%5.3f",Unc->operator()(j+k*InpEst,j+k*InpEst));
+	      printf(" (%5.3f",Unc->operator()(j+k*InpEst));
 	    }else{
-	      printf(" +- %5.3f",Unc->operator()(j+k*InpEst,j+k*InpEst));
+	      printf(" +- %5.3f",Unc->operator()(j+k*InpEst));
 	    }
 	    if(k == InpUnc-1)printf(")");
 	  }
@@ -3412,15 +4472,7 @@ void Blue::PrintCor(const Int_t k) const {
 	  if(l == -1 && IsWhichUnc(ll) == k)l = ll;
 	}
 	printf("... Blue->PrintCor(%2i): Correlation matrix for: %s \n",k,GetNamUnc(k).Data());
-	TMatrixD *F = new TMatrixD(InpEst,InpEst);
-	Int_t IRowLow = l*InpEst; 
-	Int_t IRowHig = IRowLow + InpEst-1;
-	Int_t IColLow = IRowLow; 
-	Int_t IColHig = IRowHig;
-	//  printf("... %3i, %3i, %3i, %3i \n",IRowLow, IColLow, IRowHig, IColHig);
-	Cor->GetSub(IRowLow, IRowHig, IColLow, IColHig, *F, "S");
-	F->Print();
-	F->Delete(); F = NULL;
+	Cor[l]->Print();
       }else{
 	printf("... Blue->PrintCor(%2i): Not an active uncertainty \n", k);
       }    
@@ -3458,27 +4510,17 @@ void Blue::PrintCov(const Int_t k) const {
 	  if(l == -1 && IsWhichUnc(ll) == k)l = ll;
 	}
 	printf("... Blue->PrintCov(%2i): Covariance matrix for: %s \n",k,GetNamUnc(k).Data());
-	TMatrixD *F = new TMatrixD(InpEst,InpEst);
-	TMatrixD *G = new TMatrixD(InpEst,InpEst);
 	TMatrixD *H = new TMatrixD(InpEst,InpEst);
-	Int_t IRowLow = l*InpEst; 
-	Int_t IRowHig = IRowLow + InpEst-1;
-	Int_t IColLow = IRowLow; 
-	Int_t IColHig = IRowHig;
-	//  printf("... %3i, %3i, %3i, %3i \n",IRowLow, IColLow, IRowHig, IColHig);
-	// The correlation matrix
-	Cor->GetSub(IRowLow, IRowHig, IColLow, IColHig, *F, "S");
-	// The uncertainty matrix
-	Unc->GetSub(IRowLow, IRowHig, IColLow, IColHig, *G, "S");
 	//Calculate the covariance for this source
-	Unc->GetSub(IRowLow, IRowHig, IColLow, IColHig, *H, "S");
-	H->operator*=(*F);
-	H->operator*=(*G);
+	for(Int_t i = 0; i<InpEst; i++){
+	  for(Int_t j = 0; j<InpEst; j++){
+	    H->operator()(i,j) = Unc->operator()(i+l*InpEst) * 
+	      Cor[l]->operator()(i,j) * Unc->operator()(j+l*InpEst);
+	  }
+	}
 	H->Print();
 	// Clean up
-	F->Delete(); F = NULL;
-	G->Delete(); G = NULL;
-	H->Delete(); H = NULL;
+	delete H; H = NULL;
       }else{
 	printf("... Blue->PrintCov(%2i): Not an active uncertainty \n", k);
       }    
@@ -3629,9 +4671,12 @@ void Blue::PrintCompatEst(const TString FilNam) const {
   }
   
   // Clean up and return if no plots wanted
-  if(FilNam == "NoGraphWanted"){
-    C->Delete(); C = NULL;
-    P->Delete(); P = NULL;
+  if(FilNam != "NoGraphWanted" && IsThreadSafe() == 1){
+    printf("... Blue->PrintCompatEst(): No plots in thread-safe mode \n");
+  }
+  if(FilNam == "NoGraphWanted" || IsThreadSafe() == 1){
+    delete C; C = NULL;
+    delete P; P = NULL;
     return;
   }
 
@@ -3730,8 +4775,8 @@ void Blue::PrintCompatEst(const TString FilNam) const {
   OutFil = FilNam + "_ComEst_ChiPro.pdf"; CanPoi[1]->Print(OutFil); 
 
   // Delete matrices
-  C->Delete(); C = NULL;
-  P->Delete(); P = NULL;
+  delete C; C = NULL;
+  delete P; P = NULL;
 
   return;
 };
@@ -3802,7 +4847,7 @@ void Blue::PrintParams(const Int_t Ifl) const {
     }
     // Delete dummy matrix
     //printf("... Blue->PrintParams(%2i): Dumm \n",Ifl); Dumm->Print();
-    Dumm->Delete(); Dumm = NULL;
+    delete Dumm; Dumm = NULL;
   }else{
     printf("... Blue->PrintParams(%2i): Presently not available, call FixInp() \n",Ifl);
   }
@@ -4134,6 +5179,29 @@ void Blue::PrintInspectLike() const {
   }
 };
 
+//------------------------------------------------------------------------------
+
+void Blue::PrintInspectToys() const {
+  if(IsInspectedToys() == 1){
+    printf("... Blue->PrintInspectToys(): %8i toys generated from the covariance of the estimates", ToyNum);
+    printf(" around the combined values \n");
+    for(Int_t n = 0; n<InpObs; n++){
+      printf("... Blue->PrintInspectToys(): The next observable is: %s \n", 
+	     GetNamObs(IsWhichObs(n)).Data());
+      printf("... Blue->PrintInspectToys():     Bias: %+7.4f, rms = %7.4f (expected %7.4f) \n",
+	     ToyRes->operator()(n,0), ToyRes->operator()(n,1), TMath::Sqrt(CovRes->operator()(n,n)));
+      printf("... Blue->PrintInspectToys():     Pull: %+7.4f, rms = %7.4f \n",
+	     ToyRes->operator()(n,2), ToyRes->operator()(n,3));
+      printf("... Blue->PrintInspectToys(): Coverage: %5.2f%% within 1 sigma, %5.2f%% within 2 sigma",
+	     100*ToyRes->operator()(n,4), 100*ToyRes->operator()(n,5));
+      printf(" (expected 68.27%%, 95.45%%) \n");
+    }
+    printf("... Blue->PrintInspectToys(): Mean chi squared = %7.4f for NDof = %2i \n", ToyChq, NumDof);
+  }else{
+    printf("... Blue->PrintInspectToys(): Presently not available, call InspectToys() \n");
+  }
+};
+
 //------------------------------------------------------------------------------
 // After SolveXXX()
 
@@ -4212,9 +5280,9 @@ void Blue::PrintAccImp() const {
 	    printf("... Blue->PrintAccImp(): %2i = %s:", NexImp, GetNamEst(NexImp).Data());
 	    // Print the individual estimates
 	    printf(" %5.3f", Xva->operator()(IndNex));
-	    printf(" +- %5.3f", Unc->operator()(IndNex,IndNex));
+	    printf(" +- %5.3f", Unc->operator()(IndNex));
 	    dumm = TMath::Sqrt(TMath::Power(Sig->operator()(IndNex),2.0)-
-			       TMath::Power(Unc->operator()(IndNex,IndNex),2.0));
+			       TMath::Power(Unc->operator()(IndNex),2.0));
 	    printf(" +- %5.3f", dumm);
 
 	    // Print the correlation
@@ -4232,7 +5300,7 @@ void Blue::PrintAccImp() const {
 	    printf("\n");
 	  }
 	}
-	Dumm->Delete(); Dumm = NULL;
+	delete Dumm; Dumm = NULL;
       }
       printf("... Blue->PrintAccImp():\n");
 
@@ -4391,6 +5459,10 @@ void Blue::PrintScaRho(const TString FilNam) const {
 
   // Return if no plots wanted
   if(FilNam == "NoGraphWanted")return;
+  if(IsThreadSafe() == 1){
+    printf("... Blue->PrintScaRho(): No plots in thread-safe mode \n");
+    return;
+  }
 
   //
   // ------------- Now do the figures
@@ -4676,7 +5748,7 @@ void Blue::PrintMaxVar() const {
       }
       printf("... Blue->PrintMaxVar: The scale factors f_ijk = f_ij for  (k>0) \n"); 
       RhoAct->Print();
-      RhoAct->Delete(); RhoAct = NULL;
+      delete RhoAct; RhoAct = NULL;
     }   
     printf("... Blue->PrintMaxVar: The variance after convergence = %10.8f \n",
 	   VarMax->operator()(0));
@@ -4695,6 +5767,35 @@ void Blue::PrintMaxVar() const {
   return;
 };
 
+//------------------------------------------------------------------------------
+
+void Blue::PrintSensitivity() const {
+  if(IsSolvedSensit() == 1){
+    // Per source k the derivatives for a common factor on its correlations
+    // and on all its uncertainties, the latter is Sum_i sik * d/dsik
+    Double_t ValUnc = 0, SigUnc = 0;
+    for(Int_t n = 0; n<InpObs; n++){
+      printf("... Blue->PrintSensitivity(): The next observable is: %s \n", 
+	     GetNamObs(IsWhichObs(n)).Data());
+      printf("... Blue->PrintSensitivity():        Source  dX/dRho  dS/dRho  dX/dUnc  dS/dUnc \n");
+      for(Int_t k = 0; k<InpUnc; k++){
+	ValUnc = 0;
+	SigUnc = 0;
+	for(Int_t i = 0; i<InpEst; i++){
+	  ValUnc = ValUnc + Unc->operator()(i+k*InpEst) * ValSen[n]->operator()(i,k);
+	  SigUnc = SigUnc + Unc->operator()(i+k*InpEst) * SigSen[n]->operator()(i,k);
+	}
+	printf("... Blue->PrintSensitivity(): %13s %+8.4f %+8.4f %+8.4f %+8.4f \n", 
+	       GetNamUnc(IsWhichUnc(k)).Data(),
+	       ValSen[n]->operator()(InpEst,k), SigSen[n]->operator()(InpEst,k), ValUnc, SigUnc);
+      }
+    }
+  }else{
+    printf("... Blue->PrintSensitivity(): Presently not available, call SolveSensitivity() \n");
+  }
+  return;  
+};
+
 
 //------------------------------------------------------------------------------
 
@@ -4824,6 +5925,19 @@ void Blue::PrintStatus() const {
   return;
 };
 
+//------------------------------------------------------------------------------
+
+void Blue::PrintMemory() const {
+  const TString MemNam[MemGrp] = {"Input", "Solve", "SolveScaRho", "SolveSensitivity", 
+				  "SolveAccImp", "SolveMaxVar", "Parameters", "InspectXXX"};
+  printf("... Blue->PrintMemory(): The approximate memory of this object in bytes \n");
+  for(Int_t g = 0; g<MemGrp; g++){
+    printf("... Blue->PrintMemory(): %16s = %10lld \n", MemNam[g].Data(), CalcMemory(g));
+  }
+  printf("... Blue->PrintMemory(): %16s = %10lld \n", "Total", GetMemory());
+  return;
+};
+
 //------------------------------------------------------------------------------
 // Utilities
 //------------------------------------------------------------------------------
@@ -5100,6 +6214,10 @@ void Blue::DrawSens(const Double_t xv1, const Double_t xv2,
 void Blue::DrawSens(const Double_t xv1, const Double_t xv2, 
 		    const Double_t sv1, const Double_t sv2, 
 		    const Double_t rho, const TString FilNam, const Int_t IndFig) const {
+  if(IsThreadSafe() == 1){
+    printf("... Blue->DrawSens: IGNORED No figures in thread-safe mode \n");
+    return;
+  }
   Double_t zva = sv2/sv1;
   if(zva < 1){
     printf("... Blue->DrawSens: IGNORED x2 is the more precise result, ");
@@ -5432,18 +6550,25 @@ void Blue::InspectLike(const Int_t n, const TString FilNam) {
   // Fill the type of likelihood
   LikRes->operator()(na,6) = static_cast<Double_t>(LikFla);
 
+  // The base for the evaluations of the likelihood
+  if(ChiFac == 0)FillChiBase();
+
   // Variable for the names
   char AnyName[80];
 
-  // Variables for the functions
+  // Variables for the functions, the crossings are bracketed in steps of xste
   Double_t sigx = 0, xlow =     0, xhig = 0, nsig = 5;
-  Double_t xste = 0, nste = 10000, xact = 0, fact = 0;
+  Double_t xste = 0, nste = 40, xgau = 0, sgau = 0;
   Double_t par0 = static_cast<Double_t>(n);
   Double_t par1 = static_cast<Double_t>(InpEst);
 
+  // The parameters of Likelihood() for the likelihood and the BLUE function
+  Double_t ParLik[3] = {par0, par1, 1.};
+  Double_t ParBlu[3] = {par0, par1, 0.};
+
   // Variables for the likelihood scan
   Double_t LikMax = 0, LogLik = 0, LxxMax = 0, BluMax = 0, BxxMax = 0;
-  Double_t LikLow = 0, LogBlu = 0, LikHig = 0, BluLow = 0, BluHig = 0;
+  Double_t LikLow = 0, LikHig = 0, BluLow = 0, BluHig = 0;
 
   // Set the x-axis limits and the step size
   sigx = TMath::Sqrt(CovRes->operator()(na,na));
@@ -5451,53 +6576,43 @@ void Blue::InspectLike(const Int_t n, const TString FilNam) {
   xhig = XvaRes->operator()(na) + nsig*sigx;
   xste = (xhig-xlow)/nste;
 
-  // The garbage collector
-  TF1* TF1Del;
-
-  // Define the likelihood function
-  TF1Del = (TF1*) gROOT->GetListOfFunctions()->FindObject("FuncLike");
-  if(TF1Del)delete TF1Del;
-  TF1* fLike = new TF1("FuncLike",this,&Blue::Likelihood,xlow,xhig,3,"Blue","Likelihood");
-  fLike->SetParameter(0, par0);
-  fLike->SetParameter(1, par1);
-  fLike->SetParameter(2,   1.);
-  fLike->SetNpx(100);
-  fLike->SetLineColor(kRed);
-  sprintf(AnyName,"Obs_{%i}",n);
-  fLike->GetXaxis()->SetTitle(AnyName);
-  fLike->GetYaxis()->SetTitleOffset(1.4);
-  sprintf(AnyName,"pdf(Est_{i}, Obs_{%i})",n); 
-  fLike->GetYaxis()->SetTitle(AnyName);
+  // The Gaussian case is known in closed form
+  if(LikFla >= 10)CalcLikGau(n, &xgau, &sgau);
 
   // Get the maximum of the likelihood and its x value
-  LxxMax = fLike->GetMaximumX(xlow,xhig);
-  LikMax = fLike->GetMaximum(xlow,xhig);
+  if(LikFla >= 10){
+    LxxMax = xgau;
+  }else{
+    LxxMax = CalcLikMax(n, 1, xlow, xhig);
+  }
+  LikMax = Likelihood(&LxxMax, ParLik);
   LogLik = -2.*TMath::Log(LikMax);
 
   // Get the aymmetric uncertainties of the likelihood
-  LikLow = xhig;
-  xact   = LxxMax;
-  while(LikLow == xhig){
-    xact = xact - xste;
-    fact = -2.*TMath::Log(fLike->Eval(xact));
-    if(fact > LogLik + 1)LikLow = xact;
-    if(xact < xlow){
-      LikLow = xlow;
-      printf("... Blue->InspectLike(%2i): Failed: No lower uncertainty found", n);
-      printf(" for the likelihood within plot range. Set to %5.3f \n", LikLow);
-    }
-  }
-  LikHig = xlow;
-  xact   = LxxMax;
-  while(LikHig == xlow){
-    xact = xact + xste;
-    fact = -2.*TMath::Log(fLike->Eval(xact));
-    if(fact > LogLik + 1)LikHig = xact;
-    if(xact > xhig){
-      LikHig = xhig;
-      printf("... Blue->InspectLike(%2i): Failed: No upper uncertainty found", n);
-      printf(" for the likelihood within plot range. Set to %5.3f \n", LikHig);
-    }
+  Int_t IFound = 0;
+  if(LikFla >= 10){
+    LikLow = LxxMax - sgau;
+    IFound = 1;
+    if(LikLow < xlow)IFound = 0;
+  }else{
+    IFound = CalcLikCro(n, 1, LxxMax, LogLik, xlow, xste, &LikLow);
+  }
+  if(IFound == 0){
+    LikLow = xlow;
+    printf("... Blue->InspectLike(%2i): Failed: No lower uncertainty found", n);
+    printf(" for the likelihood within plot range. Set to %5.3f \n", LikLow);
+  }
+  if(LikFla >= 10){
+    LikHig = LxxMax + sgau;
+    IFound = 1;
+    if(LikHig > xhig)IFound = 0;
+  }else{
+    IFound = CalcLikCro(n, 1, LxxMax, LogLik, xhig, xste, &LikHig);
+  }
+  if(IFound == 0){
+    LikHig = xhig;
+    printf("... Blue->InspectLike(%2i): Failed: No upper uncertainty found", n);
+    printf(" for the likelihood within plot range. Set to %5.3f \n", LikHig);
   }
 
   // Fill the matrix
@@ -5507,45 +6622,24 @@ void Blue::InspectLike(const Int_t n, const TString FilNam) {
   printf("... Blue->InspectLike(%2i): L_Like(%5.3f) = %6.3e, %+5.3f < x < %+5.3f ==> %5.3f(+-%5.3f) \n",
 	 n,LxxMax,LikMax,LikLow-LxxMax,LikHig-LxxMax,LxxMax,0.5*(LikHig-LikLow));
 
-  // Define the BLUE function
-  TF1Del = (TF1*) gROOT->GetListOfFunctions()->FindObject("FuncBlue");
-  if(TF1Del)delete TF1Del;
-  TF1* fBlue = new TF1("FuncBlue",this,&Blue::Likelihood,xlow,xhig,3,"Blue","Likelihood");
-  fBlue->SetParameter(0, par0);
-  fBlue->SetParameter(1, par1);
-  fBlue->SetParameter(2,   0.);
-  fBlue->SetNpx(100);
-  fBlue->SetLineColor(kBlue);
-
-  // Get the maximum of the BLUE function and its x value
-  BxxMax = fBlue->GetMaximumX(xlow,xhig);
-  BluMax = fBlue->GetMaximum(xlow,xhig);
-  LogBlu = -2.*TMath::Log(BluMax);
+  // Get the maximum of the BLUE function and its x value, it is always
+  // Gaussian with the covariance of Solve()
+  CalcLikGau(n, &xgau, &sgau);
+  BxxMax = xgau;
+  BluMax = Likelihood(&BxxMax, ParBlu);
 
   // Get the uncertainties of the BLUE function
-  BluLow = xhig; 
-  xact   = BxxMax;
-  while(BluLow == xhig){
-    xact = xact - xste;
-    fact = -2.*TMath::Log(fBlue->Eval(xact));
-    if(fact > LogBlu + 1)BluLow = xact;
-    if(xact < xlow){
-      BluLow = xlow;
-      printf("... Blue->InspectLike(%2i): Failed: No lower uncertainty found", n);
-      printf(" for BLUE within plot range. Set to %5.3f \n", BluLow);
-    }
-  }
-  BluHig = xlow;
-  xact   = BxxMax;
-  while(BluHig == xlow){
-    xact = xact + xste;
-    fact = -2.*TMath::Log(fBlue->Eval(xact));
-    if(fact > LogBlu + 1)BluHig = xact;
-    if(xact > xhig){
-      BluHig = xhig;
-      printf("... Blue->InspectLike(%2i): Failed: No upper uncertainty found", n);
-      printf(" for BLUE within plot range. Set to %5.3f \n", BluHig);
-    }
+  BluLow = BxxMax - sgau;
+  if(BluLow < xlow){
+    BluLow = xlow;
+    printf("... Blue->InspectLike(%2i): Failed: No lower uncertainty found", n);
+    printf(" for BLUE within plot range. Set to %5.3f \n", BluLow);
+  }
+  BluHig = BxxMax + sgau;
+  if(BluHig > xhig){
+    BluHig = xhig;
+    printf("... Blue->InspectLike(%2i): Failed: No upper uncertainty found", n);
+    printf(" for BLUE within plot range. Set to %5.3f \n", BluHig);
   }
 
   // Fill the matrix
@@ -5555,8 +6649,38 @@ void Blue::InspectLike(const Int_t n, const TString FilNam) {
   printf("... Blue->InspectLike(%2i): L_Blue(%5.3f) = %6.3e, %+5.3f < x < %+5.3f ==> %5.3f(+-%5.3f) \n",
 	 n,BxxMax,BluMax,BluLow-BxxMax,BluHig-BxxMax,BxxMax,0.5*(BluHig-BluLow));
   
-  // Do the plots if wanted
-  if(FilNam != "NoGraphWanted"){
+  // Do the plots if wanted, the functions are only needed for them
+  if(FilNam != "NoGraphWanted" && IsThreadSafe() == 1){
+    printf("... Blue->InspectLike(%2i): No plots in thread-safe mode \n", n);
+  }else if(FilNam != "NoGraphWanted"){
+
+    // The garbage collector
+    TF1* TF1Del;
+
+    // Define the likelihood function
+    TF1Del = (TF1*) gROOT->GetListOfFunctions()->FindObject("FuncLike");
+    if(TF1Del)delete TF1Del;
+    TF1* fLike = new TF1("FuncLike",this,&Blue::Likelihood,xlow,xhig,3,"Blue","Likelihood");
+    fLike->SetParameter(0, par0);
+    fLike->SetParameter(1, par1);
+    fLike->SetParameter(2,   1.);
+    fLike->SetNpx(100);
+    fLike->SetLineColor(kRed);
+    sprintf(AnyName,"Obs_{%i}",n);
+    fLike->GetXaxis()->SetTitle(AnyName);
+    fLike->GetYaxis()->SetTitleOffset(1.4);
+    sprintf(AnyName,"pdf(Est_{i}, Obs_{%i})",n); 
+    fLike->GetYaxis()->SetTitle(AnyName);
+
+    // Define the BLUE function
+    TF1Del = (TF1*) gROOT->GetListOfFunctions()->FindObject("FuncBlue");
+    if(TF1Del)delete TF1Del;
+    TF1* fBlue = new TF1("FuncBlue",this,&Blue::Likelihood,xlow,xhig,3,"Blue","Likelihood");
+    fBlue->SetParameter(0, par0);
+    fBlue->SetParameter(1, par1);
+    fBlue->SetParameter(2,   0.);
+    fBlue->SetNpx(100);
+    fBlue->SetLineColor(kBlue);
 
     // Define the canvas     
     sprintf(AnyName,"%s_CanvLike_%i",FilNam.Data(),n);
@@ -5618,12 +6742,12 @@ void Blue::InspectLike(const Int_t n, const TString FilNam) {
     sprintf(ObsNum,"%i",n);
     TString OutFil = FilNam + "_InsLik_Obs_" + ObsNum + ".pdf";
     CanLik->Print(OutFil);
-  }
 
-  // Clean up    
-  // gROOT->GetListOfFunctions()->Print();
-  delete fLike; fLike = NULL;
-  delete fBlue; fBlue = NULL;
+    // Clean up    
+    // gROOT->GetListOfFunctions()->Print();
+    delete fLike; fLike = NULL;
+    delete fBlue; fBlue = NULL;
+  }
 
   // Set the Flag
   SetIsInspectLike(1);
@@ -5633,15 +6757,123 @@ void Blue::InspectLike(const Int_t n, const TString FilNam) {
 
 //------------------------------------------------------------------------------
 
-Int_t Blue::InspectResult() const {
+void Blue::InspectToys(const Int_t NumToy, const UInt_t Seed) {
 
-  // Check whether solved
+  // Check for consistency 
   if(IsSolved() == 0){
-    printf("... Blue->InspectResult(): Presently not available, call Solve() \n");
-    return 0;
+    printf("... Blue->InspectToys(%8i): IGNORED Input not yet Solved call Solve \n", NumToy);
+    return;
+  }else if(NumToy < 1){
+    printf("... Blue->InspectToys(%8i): IGNORED At least one toy is needed \n", NumToy);
+    return;
   }
 
-  // Check the results for negative or -nan total variance
+  // The toys are x = U * XvaRes + L * z, with Cov = L * LT and z from
+  // independent standard normal variables. Each toy is combined with the
+  // weights of Solve(). The numbers z only depend on Seed, the toy and the
+  // estimate, see CalcToyGau(), such that the result does not depend on
+  // the number of threads. The toys are done in batches of ToyBat, see
+  // CalcToys(), and only the sums for the results and histograms are kept.
+  // ToyRes(n,0-5): Mean and rms of XvaRes - x, mean and rms of the pull
+  //                (XvaRes - x) / sqrt(CovRes), the fraction with
+  //                |pull| < 1 and < 2
+  // ToyPul(n,b):   The pull histogram in ToyBin bins in [-4,4]
+  // ToyPro(0,b):   The histogram of the chi squared probability in [0,1]
+  FillZero(&WrkMat[39], InpEst, InpEst);
+  TMatrixD *L = WrkMat[39];
+  if(CalcCholesky(Cov, L) == 0){
+    printf("... Blue->InspectToys(%8i): IGNORED The covariance is not positive definite \n", NumToy);
+    L = NULL;
+    return;
+  }
+
+  // The sums per slot, one batch per slot and round, see CalcToys()
+  Int_t NumBat = (NumToy + ToyBat - 1) / ToyBat;
+  Int_t NumSlo = TMath::Min(GetNumThreads(), NumBat);
+  FillSloWrk(NumSlo);
+  FillZero(&ToyRes, InpObs, ToyDim);
+  FillZero(&ToyPul, InpObs, ToyBin);
+  FillZero(&ToyPro, 1, ToyBin);
+  ToyChq = 0;
+
+  // Run the batches in rounds of NumSlo and add the slots in the order of
+  // the batches
+  Int_t NumRun = 0, IDone = 0;
+#ifdef Blue_IMT
+  ROOT::TThreadExecutor *Pool = NULL;
+  if(NumSlo > 1){
+    ROOT::EnableThreadSafety();
+    Pool = new ROOT::TThreadExecutor(NumSlo);
+  }
+#endif
+  for(Int_t b = 0; b<NumBat; b = b + NumSlo){
+    NumRun = TMath::Min(NumSlo, NumBat - b);
+    IDone = 0;
+#ifdef Blue_IMT
+    if(Pool != NULL && NumRun > 1){
+      Pool->Foreach([&](Int_t q){
+	  Long64_t ToyFir = static_cast<Long64_t>(b + q) * ToyBat;
+	  Int_t NumInB = TMath::Min(ToyBat, NumToy - (b + q) * ToyBat);
+	  CalcToys(Seed, ToyFir, NumInB, L, q);
+	}, ROOT::TSeqI(NumRun));
+      IDone = 1;
+    }
+#endif
+    if(IDone == 0){
+      for(Int_t q = 0; q<NumRun; q++){
+	Long64_t ToyFir = static_cast<Long64_t>(b + q) * ToyBat;
+	Int_t NumInB = TMath::Min(ToyBat, NumToy - (b + q) * ToyBat);
+	CalcToys(Seed, ToyFir, NumInB, L, q);
+      }
+    }
+    for(Int_t q = 0; q<NumRun; q++){
+      ToyRes->operator+=(*SloMat[q*SloNum+6]);
+      ToyPul->operator+=(*SloMat[q*SloNum+7]);
+      for(Int_t l = 0; l<ToyBin; l++){
+	ToyPro->operator()(0,l) = ToyPro->operator()(0,l) + SloMat[q*SloNum+8]->operator()(0,l);
+      }
+      ToyChq = ToyChq + SloMat[q*SloNum+8]->operator()(0,ToyBin);
+    }
+  }
+#ifdef Blue_IMT
+  delete Pool; Pool = NULL;
+#endif
+
+  // From the sums to mean, rms and fractions
+  Double_t Toy = static_cast<Double_t>(NumToy);
+  for(Int_t n = 0; n<InpObs; n++){
+    for(Int_t l = 0; l<4; l = l + 2){
+      ToyRes->operator()(n,l) = ToyRes->operator()(n,l) / Toy;
+      ToyRes->operator()(n,l+1) = TMath::Sqrt(TMath::Max(0., ToyRes->operator()(n,l+1) / Toy - 
+							 ToyRes->operator()(n,l) * ToyRes->operator()(n,l)));
+    }
+    ToyRes->operator()(n,4) = ToyRes->operator()(n,4) / Toy;
+    ToyRes->operator()(n,5) = ToyRes->operator()(n,5) / Toy;
+  }
+  ToyChq = ToyChq / Toy;
+  ToyNum = NumToy;
+
+  // Clean up
+  L = NULL;
+
+  // Set the Flag
+  SetIsInspectToys(1);
+  if(IsQuiet() == 0)PrintInspectToys();
+
+  return;
+};
+
+//------------------------------------------------------------------------------
+
+Int_t Blue::InspectResult() const {
+
+  // Check whether solved
+  if(IsSolved() == 0){
+    printf("... Blue->InspectResult(): Presently not available, call Solve() \n");
+    return 0;
+  }
+
+  // Check the results for negative or -nan total variance
   Int_t CovNeg = 0;
   for(Int_t n = 0; n<InpObs; n++){
     if(CovRes->operator()(n,n) < 0 || TMath::IsNaN(CovRes->operator()(n,n)) == 1)CovNeg = 1;
@@ -5681,7 +6913,7 @@ Int_t Blue::InspectResult() const {
 
   // Show the findings if wanted
   if(CovNeg == 1 || CorNeg == 1 || CovLar == 1){
-    if(IsPrintLevel() >= 1){
+    if(IsPrintLevel() >= 1 && IsQuiet() == 0){
       Int_t NegEig = GetMatEigen(Cov);
       if(CorNeg == 1)printf("... Blue->InspectResult(): At least one uncertainty is negative or -nan \n");
       if(CovNeg == 1)printf("... Blue->InspectResult(): The total uncertainty is negative or -nan \n");
@@ -5833,7 +7065,7 @@ void Blue::LatexResult(const TString FilNam, const TString ForVal, const TString
   for(Int_t k = 0; k<InpUnc; k++){
     IRet = sprintf(c,"%s",GetNamUnc(IsWhichUnc(k)).Data()); ofs<<c;
     for(Int_t i = 0; i<InpEst; i++){
-      Sys = Unc->operator()(i+k*InpEst,i+k*InpEst);
+      Sys = Unc->operator()(i+k*InpEst);
       if(k > 0)SysEst->operator()(i) = SysEst->operator()(i) + Sys*Sys;
       IRet = sprintf(c,Format,Sys); ofs<<c;
     }
@@ -6058,8 +7290,8 @@ void Blue::LatexResult(const TString FilNam, const TString ForVal, const TString
 	 FilNam.Data());
 
   // Clean up
-  SysEst->Delete(); SysEst = NULL;
-  SysObs->Delete(); SysObs = NULL;
+  delete SysEst; SysEst = NULL;
+  delete SysObs; SysObs = NULL;
 
   return;
 };
@@ -6093,16 +7325,14 @@ void Blue::DisplayResult(const Int_t n, const TString FilNam,
     return;
   }
 
-  // Reset the arrays for PlotRes
-  for(Int_t i = 0; i<InpEst+1; i++){
-    Indx[i] = 0;
-    Colo[i] = 0;
-    Name[i] = "";
-    Valu[i] = 0.;
-    Stat[i] = 0.;
-    Syst[i] = 0.;
-    Full[i] = 0.;
-  }
+  // The arrays for PlotRes, local such that the display stays const
+  Int_t*    Indx = new Int_t[InpEstOrig+1];
+  Int_t*    Colo = new Int_t[InpEstOrig+1];
+  TString*  Name = new TString[InpEstOrig+1];
+  Double_t* Valu = new Double_t[InpEstOrig+1];
+  Double_t* Stat = new Double_t[InpEstOrig+1];
+  Double_t* Syst = new Double_t[InpEstOrig+1];
+  Double_t* Full = new Double_t[InpEstOrig+1];
 
   // Declare variables
   TVectorD* SysEst = new TVectorD(InpEst);
@@ -6151,7 +7381,7 @@ void Blue::DisplayResult(const Int_t n, const TString FilNam,
   for(Int_t i = 0; i<InpEst; i++){
     if(EstWhichObs(IsWhichEst(i)) == n){
       ind = ind + 1;
-      Stat[ind] = Unc->operator()(i+0*InpEst,i+0*InpEst);
+      Stat[ind] = Unc->operator()(i+0*InpEst);
     }
   }
 
@@ -6159,7 +7389,7 @@ void Blue::DisplayResult(const Int_t n, const TString FilNam,
   for(Int_t k = 1; k<InpUnc; k++){
     for(Int_t i = 0; i<InpEst; i++){
       if(EstWhichObs(IsWhichEst(i)) == n){
-	Sys = Unc->operator()(i+k*InpEst,i+k*InpEst);
+	Sys = Unc->operator()(i+k*InpEst);
 	SysEst->operator()(i) = SysEst->operator()(i) + Sys*Sys;
       }
     }
@@ -6193,11 +7423,18 @@ void Blue::DisplayResult(const Int_t n, const TString FilNam,
   TString FulNam = FilNam + "_DisRes_Obs_" + ObsNum;
 
   // Produce the file
-  PlotRes(N, FulNam, ForVal, ForUnc);
+  PlotRes(N, FulNam, ForVal, ForUnc, Indx, Colo, Name, Valu, Stat, Syst, Full);
 
   // Clean up
-  SysEst->Delete(); SysEst = NULL;
-  SysObs->Delete(); SysObs = NULL;
+  delete [] Indx; Indx = NULL;
+  delete [] Colo; Colo = NULL;
+  delete [] Name; Name = NULL;
+  delete [] Valu; Valu = NULL;
+  delete [] Stat; Stat = NULL;
+  delete [] Syst; Syst = NULL;
+  delete [] Full; Full = NULL;
+  delete SysEst; SysEst = NULL;
+  delete SysObs; SysObs = NULL;
   return;
 };
 
@@ -6238,16 +7475,14 @@ void Blue::DisplayAccImp(const Int_t n, const TString FilNam,
       return;
     }
     
-    // Reset the arrays for PlotRes
-    for(Int_t i = 0; i<InpEst+1; i++){
-      Indx[i] = 0;
-      Colo[i] = 0;
-      Name[i] = "";
-      Valu[i] = 0.;
-      Stat[i] = 0.;
-      Syst[i] = 0.;
-      Full[i] = 0.;
-    }
+    // The arrays for PlotRes, local such that the display stays const
+    Int_t*    Indx = new Int_t[InpEstOrig+1];
+    Int_t*    Colo = new Int_t[InpEstOrig+1];
+    TString*  Name = new TString[InpEstOrig+1];
+    Double_t* Valu = new Double_t[InpEstOrig+1];
+    Double_t* Stat = new Double_t[InpEstOrig+1];
+    Double_t* Syst = new Double_t[InpEstOrig+1];
+    Double_t* Full = new Double_t[InpEstOrig+1];
     
     // Get the dimension and the index of the last one to be combined for the
     // wanted precision
@@ -6284,7 +7519,16 @@ void Blue::DisplayAccImp(const Int_t n, const TString FilNam,
     TString FulNam = FilNam + "_AccImp_Obs_" + ObsNum;
     
     // Produce the file
-    PlotRes(NumCom, FulNam, ForVal, ForUnc);    
+    PlotRes(NumCom, FulNam, ForVal, ForUnc, Indx, Colo, Name, Valu, Stat, Syst, Full);
+
+    // Clean up
+    delete [] Indx; Indx = NULL;
+    delete [] Colo; Colo = NULL;
+    delete [] Name; Name = NULL;
+    delete [] Valu; Valu = NULL;
+    delete [] Stat; Stat = NULL;
+    delete [] Syst; Syst = NULL;
+    delete [] Full; Full = NULL;
   }else{
     printf("... Blue->DisplayAccImp(%2i): Presently not available, call SolveAccImp() \n",n);
   }
@@ -6306,16 +7550,17 @@ void Blue::Construct(const Int_t NumEst, const Int_t NumUnc, const Int_t NumObs,
   // Set print level to low
   SetPrintLevel(0);
 
-  // Set the date
-  Date   = new TDatime();
-  Months = new TString[12];
-  Months[0] = "Jan"; Months[1] = "Feb"; Months[ 2] = "Mar"; Months[ 3] = "Apr";
-  Months[4] = "May"; Months[5] = "Jun"; Months[ 6] = "Jul"; Months[ 7] = "Aug";
-  Months[8] = "Sep"; Months[9] = "Oct"; Months[10] = "Nov"; Months[11] = "Dec";
+  // Do the scans in one thread
+  NumThr = 1;
+
+  // Set the date, only the string is kept
+  TDatime Date;
+  const char *Months[12] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun",
+			    "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
 
   char Buffer[100];
-  sprintf(Buffer, "%s %2i, %4i", Months[Date->GetMonth()-1].Data(),
-	   Date->GetDay(), Date->GetYear());
+  sprintf(Buffer, "%s %2i, %4i", Months[Date.GetMonth()-1],
+	   Date.GetDay(), Date.GetYear());
   Today = &Buffer[0]; 
 
   // Set actual dimensions
@@ -6434,6 +7679,11 @@ void Blue::Construct(const Int_t NumEst, const Int_t NumUnc, const Int_t NumObs,
     } 
   }
 
+  // Nothing is fixed yet, the flags are needed by ResetScaRho()
+  InpDir = 1;
+  UncDir = new Int_t[InpUncOrig];
+  for(Int_t k = 0; k<InpUncOrig; k++)UncDir[k] = 0;
+
   // Set the actual factors and ranges for SolveScaRho
   ActFac = new TMatrixD(InpUncOrig,InpFac);
   MinFac = new TMatrixD(InpUncOrig,InpFac);
@@ -6442,19 +7692,41 @@ void Blue::Construct(const Int_t NumEst, const Int_t NumUnc, const Int_t NumObs,
   FlaFac = 0;
   FaiFac = 0;
 
-  // Set the number of scan values and the result matrices
+  // The buffers of the SolveXXX() and InspectXXX() modes are only allocated
+  // when the mode is used, such that many small objects stay small, see
+  // GetMemory(). Until then they are NULL.
+
+  // Set the number of scan values and the result matrices, see SolveScaRho()
   InrFac = 10;
   ValSca = new TMatrixD* [InpObsOrig];
   SigSca = new TMatrixD* [InpObsOrig];
   VtoSca = new TMatrixD* [InpObsOrig];
   StoSca = new TMatrixD* [InpObsOrig];
   for(Int_t n = 0; n<InpObsOrig; n++){
-    ValSca[n] = new TMatrixD(InpUncOrig*InpFac,InrFac);
-    SigSca[n] = new TMatrixD(InpUncOrig*InpFac,InrFac);
-    VtoSca[n] = new TMatrixD(InpFac,InrFac);
-    StoSca[n] = new TMatrixD(InpFac,InrFac);
+    ValSca[n] = NULL;
+    SigSca[n] = NULL;
+    VtoSca[n] = NULL;
+    StoSca[n] = NULL;
+  }
+
+  // The derivatives of SolveSensitivity()
+  ValSen = new TMatrixD* [InpObsOrig];
+  SigSen = new TMatrixD* [InpObsOrig];
+  for(Int_t n = 0; n<InpObsOrig; n++){
+    ValSen[n] = NULL;
+    SigSen[n] = NULL;
   }
 
+  // The base covariance for the scans, see FillScaBase()
+  SetLowRankScan(1);
+  ScaBas = 0;
+  ScaFut = 0;
+  ScaUpd = 0;
+  BasFac = NULL;
+  BasFij = NULL;
+  BasCovI = NULL;
+  BasCovU = NULL;
+
   // Fill lists of active estimates and uncertainties
   LisEst = new Int_t[InpEstOrig];
   LisUnc = new Int_t[InpUncOrig];
@@ -6513,61 +7785,53 @@ void Blue::Construct(const Int_t NumEst, const Int_t NumUnc, const Int_t NumObs,
   SetIsSolvedInfWei(0);
   SetIsSolvedPosWei(0);
   SetIsSolvedMaxVar(0);
+  SetIsSolvedSensit(0);
 
   IsRelUncMode  = 0;
 
   // Array of coefficients forBLUE with relative uncertainties
   Cof  = new TMatrixD(InpEstOrig*InpUncOrig,MaxCof);
+  NumRel = 0;
+  HisRel = new TMatrixD(1,InpObsOrig);
 
   // Reset list of importance and the steering flag for SolveAccImp
   PreAcc = 1.;
   IntAcc = 0;
   LisImp = new Int_t[InpEstOrig];
   for (Int_t i = 0; i < InpEstOrig; i++){LisImp[i] = -1;};
-  LasImp = new TMatrixD(1,InpObsOrig);
-  IndImp = new TMatrixD(InpEstOrig,InpObsOrig);
-  ValImp = new TMatrixD(InpEstOrig,InpObsOrig);
-  UncImp = new TMatrixD(InpEstOrig,InpObsOrig);
-  StaImp = new TMatrixD(InpEstOrig,InpObsOrig);
-  SysImp = new TMatrixD(InpEstOrig,InpObsOrig);
-
-  // The arrays for PlotRes
-  Indx = new Int_t[InpEstOrig+1];
-  Colo = new Int_t[InpEstOrig+1];
-  Name = new TString[InpEstOrig+1];
-  Valu = new Double_t[InpEstOrig+1];
-  Stat = new Double_t[InpEstOrig+1];
-  Syst = new Double_t[InpEstOrig+1];
-  Full = new Double_t[InpEstOrig+1];
-  for(Int_t i = 0; i<InpEstOrig+1; i++){
-    Indx[i] = 0;
-    Colo[i] = 0;
-    Name[i] = "";
-    Valu[i] = 0.;
-    Stat[i] = 0.;
-    Syst[i] = 0.;
-    Full[i] = 0.;
-  }
-
-  // The list of initial/final variances/correlations for SolveMaxVar
-  VarMax = new TVectorD(InpObsOrig);
-  VarMin = new TVectorD(InpObsOrig);
-  RhoMax = new TMatrixD(InpEstOrig,InpEstOrig);
-  RhoMin = new TMatrixD(InpEstOrig,InpEstOrig);
-  RhoOoz = new TMatrixD(InpEstOrig,InpEstOrig);
+  LasImp = NULL;
+  IndImp = NULL;
+  ValImp = NULL;
+  UncImp = NULL;
+  StaImp = NULL;
+  SysImp = NULL;
+
+  // The list of initial/final variances/correlations for SolveMaxVar,
+  // RhoFij is only read for IFuCor = 1 which is only set there
+  VarMax = NULL;
+  VarMin = NULL;
+  RhoMax = NULL;
+  RhoMin = NULL;
+  RhoOoz = NULL;
 
   RhoFco = 1.;
-  RhoFpk = new TVectorD(InpUncOrig);
-  RhoFij = new TMatrixD(InpEstOrig,InpEstOrig);
+  RhoFpk = NULL;
+  RhoFij = NULL;
   IFuCor = 0;
   IFuFla = 0;
   IFuFai = new Int_t[3];
+  TolMax = 0;
 
   // Save harbor for all inputs
   XvaOrig = new TVectorD(InpEstOrig);
   SigOrig = new TVectorD(InpEstOrig);
-  UncOrig = new TMatrixD(InpEstOrig*InpUncOrig,InpEstOrig*InpUncOrig);
-  CorOrig = new TMatrixD(InpEstOrig*InpUncOrig,InpEstOrig*InpUncOrig);
+  UncOrig = new TVectorD(InpEstOrig*InpUncOrig);
+  CorOrig = new TMatrixD* [InpUncOrig];
+  for(Int_t k = 0; k<InpUncOrig; k++){
+    CorOrig[k] = new TMatrixD(InpEstOrig,InpEstOrig);
+  }
+  CorTypOrig = new Int_t[InpUncOrig];
+  for(Int_t k = 0; k<InpUncOrig; k++)CorTypOrig[k] = 2;
   UmaOrig = new TMatrixD(InpEstOrig,InpObsOrig);
   UtrOrig = new TMatrixD(InpObsOrig,InpEstOrig);
 
@@ -6575,11 +7839,34 @@ void Blue::Construct(const Int_t NumEst, const Int_t NumUnc, const Int_t NumObs,
   Xva = new TVectorD(InpEstOrig);
   Sig = new TVectorD(InpEstOrig);
 
+  // Per source uncertainties and correlations
+  Unc = new TVectorD(InpEstOrig*InpUncOrig);
+  Cor = new TMatrixD* [InpUncOrig];
+  for(Int_t k = 0; k<InpUncOrig; k++){
+    Cor[k] = new TMatrixD(InpEstOrig,InpEstOrig);
+  }
+  CorTyp = new Int_t[InpUncOrig];
+  for(Int_t k = 0; k<InpUncOrig; k++)CorTyp[k] = 2;
+
   // Matrices to do the job
-  Unc  = new TMatrixD(InpEstOrig*InpUncOrig,InpEstOrig*InpUncOrig);
-  Cor  = new TMatrixD(InpEstOrig*InpUncOrig,InpEstOrig*InpUncOrig);
   Cov  = new TMatrixD(InpEstOrig,InpEstOrig);
+  CovL = new TMatrixD(InpEstOrig,InpEstOrig);
   CovI = new TMatrixD(InpEstOrig,InpEstOrig);
+  CovD = new TVectorD(InpEstOrig);
+  CovS = new TMatrixD(InpEstOrig,InpUncOrig);
+  CovW = new TMatrixD(InpUncOrig,InpUncOrig);
+  CovT = new TMatrixD(InpUncOrig,1);
+
+  // The workspace, shaped when needed
+  NumAll = 0;
+  WrkMat = new TMatrixD*[WrkNum];
+  for(Int_t w = 0; w<WrkNum; w++)WrkMat[w] = NULL;
+  WrkVec = NULL;
+  WrkInt = new Int_t[InpUncOrig+InpEstOrig];
+  SloMax = 0;
+  SloMat = NULL;
+  SloInt = NULL;
+  SloAll = NULL;
   Rho  = new TMatrixD(InpEstOrig,InpEstOrig);
   Lam  = new TMatrixD(InpEstOrig,InpObsOrig);
   Pul  = new TVectorD(InpEstOrig);
@@ -6601,34 +7888,47 @@ void Blue::Construct(const Int_t NumEst, const Int_t NumUnc, const Int_t NumObs,
   MarWei = new TVectorD(InpEstOrig);
   BluWei = new TVectorD(InpEstOrig);
 
-  // Matrices for the parameters
-  SRat = new TMatrixD(InpEstOrig,InpEstOrig);
-  Beta = new TMatrixD(InpEstOrig,InpEstOrig);
-  Sigx = new TMatrixD(InpEstOrig,InpEstOrig);
-  DBdr = new TMatrixD(InpEstOrig,InpEstOrig);
-  DSdr = new TMatrixD(InpEstOrig,InpEstOrig);
-  DBdz = new TMatrixD(InpEstOrig,InpEstOrig);
-  DSdz = new TMatrixD(InpEstOrig,InpEstOrig);
+  // Matrices for the parameters, see CalcParams()
+  SRat = NULL;
+  Beta = NULL;
+  Sigx = NULL;
+  DBdr = NULL;
+  DSdr = NULL;
+  DBdz = NULL;
+  DSdz = NULL;
 
-  // Reset the flag
+  // Reset the flags
   SetCalcedParams(0);
+  SetPosDefCov(0);
+  SetLowRankCov(0);
 
   // Matrix for control of the relative uncertainties 
   IndRel = new TMatrixD(InpEstOrig,InpUncOrig);
 
   // Matrices for the InspectLike results
-  // ChiRes holds Chiq and det(V) per point
-  ChiRes = new TMatrixD(2,1);
-  // LikRes holds result x, dxlow, dxhig
-  LikRes = new TMatrixD(InpObsOrig,LikDim);
+  // The base for CalcChiRes() is filled when needed
+  ChiFac = 0;
+  ChiDet = 0;
+  ChiCov = NULL;
+  ChiCovI = NULL;
+  // LikRes holds result x, dxlow, dxhig, shaped by FixInp()
+  LikRes = NULL;
   LikFla = 0;
   SetIsInspectLike(0);
 
+  // Matrices for the InspectToys results
+  ToyRes = NULL;
+  ToyPul = NULL;
+  ToyPro = NULL;
+  ToyNum = 0;
+  ToyChq = 0;
+  SetIsInspectToys(0);
+
   // Switch off quiet mode
   SetQuiet(0);
 
-  //Setup ROOT style
-  SetupRoot();
+  //Setup ROOT style, not in thread-safe mode
+  if(IsThreadSafe() == 0)SetupRoot();
 };
 
 //------------------------------------------------------------------------------
@@ -6699,11 +7999,34 @@ void Blue::SolveScaRho(const Int_t FlaFac, const TMatrixD* MinFac, const TMatrix
 
   // Solve once store the result
   Solve();
+
+  // The uncertainty of the most precise estimate, see InspectResult()
+  TVectorD* SigPre = new TVectorD(InpObs);
+  CalcScaPre(SigPre);
+
+  // All points only differ by a few factors from unity, use this as the
+  // base for the low rank updates
+  TMatrixD* BasOne = new TMatrixD(InpUncOrig,InpFac);
+  for(Int_t k = 0; k<InpUncOrig; k++){
+    for(Int_t l = 0; l<InpFac; l++){
+      BasOne->operator()(k,l) = 1.0;
+    }
+  }
+  if(IsLowRankScan() == 1)FillScaBase(BasOne, NULL);
+  delete BasOne; BasOne = NULL;
+
+  // Store the result the same way as for the points below, such that
+  // an unchanged point gives exactly no difference
   TVectorD* ValDef = new TVectorD(InpObs);
   TVectorD* SigDef = new TVectorD(InpObs);
+  TMatrixD* ValOne = new TMatrixD(1,InpObs);
+  TMatrixD* VarOne = new TMatrixD(1,InpObs);
+  Int_t WooOne = 0;
+  FillSloWrk(1);
+  CalcScaRho(ActFac, NULL, SigPre, 0, 0, ValOne, VarOne, &WooOne);
   for(Int_t n = 0; n<InpObs; n++){
-    ValDef->operator()(n) = XvaRes->operator()(n);
-    SigDef->operator()(n) = TMath::Sqrt(CovRes->operator()(n,n));
+    ValDef->operator()(n) = ValOne->operator()(0,n);
+    SigDef->operator()(n) = TMath::Sqrt(VarOne->operator()(0,n));
     //printf("... Blue->SolveScaRho(): Next Obs n = %2i = %5.3f +- %5.3f \n",
     //IsWhichObs(n), ValDef->operator()(n), SigDef->operator()(n));
   }
@@ -6713,10 +8036,10 @@ void Blue::SolveScaRho(const Int_t FlaFac, const TMatrixD* MinFac, const TMatrix
 
   // Set the matrices for the results of the scan
   for(Int_t n = 0; n<InpObs; n++){  
-    ValSca[n]->Delete(); ValSca[n] = new TMatrixD(InpUnc*InpFac,InrFac);
-    SigSca[n]->Delete(); SigSca[n] = new TMatrixD(InpUnc*InpFac,InrFac);
-    VtoSca[n]->Delete(); VtoSca[n] = new TMatrixD(InpFac,InrFac);
-    StoSca[n]->Delete(); StoSca[n] = new TMatrixD(InpFac,InrFac);
+    FillZero(&ValSca[n], InpUnc*InpFac, InrFac);
+    FillZero(&SigSca[n], InpUnc*InpFac, InrFac);
+    FillZero(&VtoSca[n], InpFac, InrFac);
+    FillZero(&StoSca[n], InpFac, InrFac);
   }
 
   // Set the first value and the step size
@@ -6731,45 +8054,33 @@ void Blue::SolveScaRho(const Int_t FlaFac, const TMatrixD* MinFac, const TMatrix
     }
   }
     
-  // Perform the loop
+  // Perform the loop, only store the factors of each point. The points are
+  // independent of each other and are combined afterwards via CalcScaRho()
+  // from the fixed input, i.e. one after the other or by NumThr threads.
+  Int_t NumPnt = InpUnc*InpFac*InrFac;
+  TMatrixD** PntFac = new TMatrixD*[NumPnt];
+  TMatrixD* ValPnt = new TMatrixD(NumPnt,InpObs);
+  TMatrixD* VarPnt = new TMatrixD(NumPnt,InpObs);
+  Int_t* FaiPnt = new Int_t[NumPnt];
+  Int_t* WooPnt = new Int_t[NumPnt];
   Int_t ka = 0;
-  Int_t FaiAct = 0;
+  Int_t p = 0;
   ReleaseInp();  
   for(Int_t ll = 0; ll<InrFac; ll++){
     //printf("... Blue->SolveScaRho(): \n");
     for(Int_t l = 0; l<InpFac; l++){
       ka = 0;    
       for(Int_t k = 0; k<InpUncOrig; k++){
-	FaiAct = 0;
 	if(IsActiveUnc(k) == 1){
 	  SetRhoFacUnc(k, l, RhoLoo->operator()(k,l));
 	  //printf("... Blue->SolveScaRho(): k = %2i, l = %2i, rho = %5.2f(%5.2f,%5.2f) \n", 
 	  //	 k, l, ActFac->operator()(k,l), MinFac->operator()(k,l), MaxFac->operator()(k,l));
 	  //PrintMatrix(ActFac);
-	  FixInp();
-	  //PrintCor(k);
-	  Solve();
-	  FaiAct = InspectResult();
-	  for(Int_t n = 0; n<InpObs; n++){
-	    // Check for failures
-	    if(FaiAct < 0){
-	      FaiFac = FaiFac + 1;
-	      //printf("... Blue->SolveScaRho(): Failure = %2i \n", FaiFac);
-	      ValSca[n]->operator()(ka+l*InpUnc,ll) = -1.00;
-	      SigSca[n]->operator()(ka+l*InpUnc,ll) = -1.00;
-	    }else{
-	      ValSca[n]->operator()(ka+l*InpUnc,ll) = XvaRes->operator()(n) - ValDef->operator()(n);
-	      SigSca[n]->operator()(ka+l*InpUnc,ll) = TMath::Sqrt(CovRes->operator()(n,n))-SigDef->operator()(n);
-	    }
-	  }
-	  //printf("... Blue->SolveScaRho(): ValSca \n"); ValSca[0]->Print();
-	  //printf("... Blue->SolveScaRho(): SigSca \n"); SigSca[0]->Print();
-	  ReleaseInp();
+	  p = ka + l*InpUnc + ll*InpUnc*InpFac;
+	  PntFac[p] = new TMatrixD(InpUncOrig,InpFac);
+	  PntFac[p]->SetSub(0,0,*ActFac);
 	  // Keep scaling independent per group l
 	  if(FlaFac == 0)SetRhoFacUnc(k, l, 1.0);
-	  //printf("... Blue->SolveScaRho(): k = %2i, l = %2i, rho = %5.2f(%5.2f,%5.2f) \n", 
-	  //k, l, ActFac->operator()(k,l), MinFac->operator()(k,l), MaxFac->operator()(k,l));
-	  //PrintMatrix(ActFac);
 	  ka = ka + 1;
 	}
       }
@@ -6786,6 +8097,72 @@ void Blue::SolveScaRho(const Int_t FlaFac, const TMatrixD* MinFac, const TMatrix
     }
   }
 
+  // Combine all points, each thread only writes to its own rows and uses
+  // its own slot q of the workspace for the points q, q+NumSlo, ...
+  Int_t IDone = 0;
+#ifdef Blue_IMT
+  Int_t NumSlo = TMath::Min(GetNumThreads(), NumPnt);
+  if(NumSlo > 1){
+    FillSloWrk(NumSlo);
+    ROOT::EnableThreadSafety();
+    ROOT::TThreadExecutor Pool(NumSlo);
+    Pool.Foreach([&](Int_t q){
+	for(Int_t pp = q; pp<NumPnt; pp = pp + NumSlo){
+	  FaiPnt[pp] = CalcScaRho(PntFac[pp], NULL, SigPre, pp, q, ValPnt, VarPnt, WooPnt);
+	}
+      }, ROOT::TSeqI(NumSlo));
+    IDone = 1;
+  }
+#endif
+  if(IDone == 0){
+    for(p = 0; p<NumPnt; p++){
+      FaiPnt[p] = CalcScaRho(PntFac[p], NULL, SigPre, p, 0, ValPnt, VarPnt, WooPnt);
+    }
+  }
+  ScaBas = 0;
+
+  // Report the points from low rank updates
+  if(IsPrintLevel() >= 1){
+    Int_t NumWoo = 0, NumUns = 0;
+    for(p = 0; p<NumPnt; p++){
+      if(WooPnt[p] ==  1)NumWoo = NumWoo + 1;
+      if(WooPnt[p] == -1)NumUns = NumUns + 1;
+    }
+    printf("... Blue->SolveScaRho(%2i): %4i of %4i points from low rank updates,", FlaFac, NumWoo, NumPnt);
+    printf(" %4i unstable ones solved in full \n", NumUns);
+  }
+
+  // Store the differences to the default in the order of the loop
+  for(Int_t ll = 0; ll<InrFac; ll++){
+    for(Int_t l = 0; l<InpFac; l++){
+      for(ka = 0; ka<InpUnc; ka++){
+	p = ka + l*InpUnc + ll*InpUnc*InpFac;
+	for(Int_t n = 0; n<InpObs; n++){
+	  // Check for failures
+	  if(FaiPnt[p] < 0){
+	    FaiFac = FaiFac + 1;
+	    //printf("... Blue->SolveScaRho(): Failure = %2i \n", FaiFac);
+	    ValSca[n]->operator()(ka+l*InpUnc,ll) = -1.00;
+	    SigSca[n]->operator()(ka+l*InpUnc,ll) = -1.00;
+	  }else{
+	    ValSca[n]->operator()(ka+l*InpUnc,ll) = ValPnt->operator()(p,n) - ValDef->operator()(n);
+	    SigSca[n]->operator()(ka+l*InpUnc,ll) = TMath::Sqrt(VarPnt->operator()(p,n)) - SigDef->operator()(n);
+	  }
+	}
+      }
+    }
+  }
+  //printf("... Blue->SolveScaRho(): ValSca \n"); ValSca[0]->Print();
+  //printf("... Blue->SolveScaRho(): SigSca \n"); SigSca[0]->Print();
+  for(p = 0; p<NumPnt; p++){
+    delete PntFac[p]; PntFac[p] = NULL;
+  }
+  delete [] PntFac; PntFac = NULL;
+  delete ValPnt; ValPnt = NULL;
+  delete VarPnt; VarPnt = NULL;
+  delete [] FaiPnt; FaiPnt = NULL;
+  delete [] WooPnt; WooPnt = NULL;
+
   // Fill the total values depending on FlaFac
   Double_t ValSum = 0, SigSum = 0; 
   for(Int_t n = 0; n<InpObs; n++){  
@@ -6829,11 +8206,14 @@ void Blue::SolveScaRho(const Int_t FlaFac, const TMatrixD* MinFac, const TMatrix
   SetQuiet(0);
 
   // Clean up
-  SavFac->Delete(); SavFac = NULL;
-  ValDef->Delete(); ValDef = NULL;
-  SigDef->Delete(); SigDef = NULL;
-  RhoLoo->Delete(); RhoLoo = NULL;
-  RhoSte->Delete(); RhoSte = NULL;
+  delete SavFac; SavFac = NULL;
+  delete ValDef; ValDef = NULL;
+  delete SigDef; SigDef = NULL;
+  delete RhoLoo; RhoLoo = NULL;
+  delete RhoSte; RhoSte = NULL;
+  delete SigPre; SigPre = NULL;
+  delete ValOne; ValOne = NULL;
+  delete VarOne; VarOne = NULL;
 
   // Set the flag
   SetIsSolvedScaRho(1);
@@ -6916,6 +8296,16 @@ void Blue::SetIsSolvedMaxVar(const Int_t l){
 
 //------------------------------------------------------------------------------
 
+void Blue::SetIsSolvedSensit(const Int_t l){
+  IsSolveSensit = l;
+  if(l == 1 && IsQuiet() == 0){
+    printf("... Blue->SetIsSolvedSensit(%2i): Input was solved with its Sensit-ivities! \n",l);
+    printf("\n");
+  }
+};
+
+//------------------------------------------------------------------------------
+
 void Blue::SetIsInspectLike(const Int_t l){
   IsInspectLike = l;
   if(l == 1){
@@ -6924,74 +8314,202 @@ void Blue::SetIsInspectLike(const Int_t l){
   }
 };
 
+//------------------------------------------------------------------------------
+
+void Blue::SetIsInspectToys(const Int_t l){
+  IsInspectToys = l;
+  if(l == 1 && IsQuiet() == 0){
+    printf("... Blue->SetIsInspectToys(%2i): The toys were inspected! \n",l);
+    printf("\n");
+  }
+};
+
 //------------------------------------------------------------------------------
 // Filler
 //------------------------------------------------------------------------------
 
 void Blue::FillCov(){
   // Reset the Covariance Matrix
-  Cov->Delete(); Cov  = new TMatrixD(InpEst,InpEst);
-
-  TMatrixD *C = new TMatrixD(InpEst,InpEst);
-  TMatrixD *E = new TMatrixD(InpEst,InpEst);
-  TMatrixD *H = new TMatrixD(InpEst,InpEst);
-  TMatrixD *I = new TMatrixD(InpEst,InpEst);
+  FillZero(&Cov, InpEst, InpEst);
 
-  Int_t IRowLow, IRowHig, IColLow, IColHig;
+  // Sum it up = sum E*C*E, with E the diagonal matrix of sigmas per source.
+  // Uncorrelated sources only add to the diagonal, fully correlated ones are
+  // an outer product of the sigmas, only general ones need the correlations.
+  Double_t Sigik, Sigjk;
   for(Int_t k = 0; k<InpUnc; k++){
-    IRowLow = k*InpEst; 
-    IRowHig = IRowLow + InpEst-1;
-    IColLow = IRowLow;
-    IColHig = IRowHig;
-    //printf("... Blue->FillCov(): %3i, %3i, %3i, %3i \n",IRowLow, IColLow, IRowHig, IColHig);
-
-    // Sigmas per source
-    Unc->GetSub(IRowLow, IRowHig, IColLow, IColHig, *E, "S");
-    //E->Print();
-    
-    // Correlation per source
-    Cor->GetSub(IRowLow, IRowHig, IColLow, IColHig, *C, "S");
-    //C->Print();
-
-    // Sum it up = sum E*C*E
-    H->Mult(*E, *C);
-    I->Mult(*H, *E);
-    //I->Print();
-
-    Cov->operator+=(*I);
+    //printf("... Blue->FillCov(): Correlation %2i Type %2i \n",k,CorTyp[k]); Cor[k]->Print();
+    for(Int_t i = 0; i<InpEst; i++){
+      Sigik = Unc->operator()(i+k*InpEst);
+      if(CorTyp[k] == 0){
+	Cov->operator()(i,i) = Cov->operator()(i,i) + Sigik * Sigik;
+      }else{
+	for(Int_t j = i; j<InpEst; j++){
+	  Sigjk = Unc->operator()(j+k*InpEst);
+	  if(CorTyp[k] == 1){
+	    Cov->operator()(i,j) = Cov->operator()(i,j) + Sigik * Sigjk;
+	  }else{
+	    Cov->operator()(i,j) = Cov->operator()(i,j) + 
+	      Sigik * Cor[k]->operator()(i,j) * Sigjk;
+	  }
+	  Cov->operator()(j,i) = Cov->operator()(i,j);
+	}
+      }
+    }
     //printf("... Blue->FillCov(): Covariance \n"); Cov->Print();
   }
 
   // Enable to check for positive Eigenvalues
   // ICheck = GetMatEigen(Cov);
-
-  // Clean up
-  C->Delete(); C = NULL;
-  E->Delete(); E = NULL;
-  H->Delete(); H = NULL;
-  I->Delete(); I = NULL;
   return;
 };
 
 //------------------------------------------------------------------------------
 
 void Blue::FillCovInvert(){
-  // Reset inverse covariance
-  CovI->Delete(); CovI = new TMatrixD(InpEst,InpEst);
+  // Reset inverse covariance and its Cholesky factor
+  FillZero(&CovI, InpEst, InpEst);
+  FillZero(&CovL, InpEst, InpEst);
   
-  // Get covarianca and invert
-  CovI->SetSub(0,0,*Cov);
-  CovI->Invert();
+  // For only un-correlated and fully correlated sources use the
+  // Woodbury identity for Cov = D + S * ST, see FillCovLowRank()
+  // (D + S * ST)-1 = D-1 - D-1 * S * (1 + ST * D-1 * S)-1 * ST * D-1
+  // This only replaces the O(N^3) factorisation of Cov by O(N^2*K) for K
+  // columns of S. Cov and CovI are still filled as dense N x N matrices
+  // for the other solvers and the printout, i.e. the combination as a
+  // whole stays O(N^2*K) and does not become O(N*K^2).
+  SetLowRankCov(0);
+  if(FillCovLowRank() == 1){
+    SetLowRankCov(1);
+    SetPosDefCov(1);
+    Int_t NRank = CovS->GetNcols();
+    FillZero(&WrkMat[3], InpEst, NRank);
+    FillZero(&WrkMat[4], NRank, NRank);
+    TMatrixD *V = WrkMat[3];
+    TMatrixD *W = WrkMat[4];
+    CalcCholInvert(CovW, W);
+    for(Int_t i = 0; i<InpEst; i++){
+      for(Int_t r = 0; r<NRank; r++){
+	V->operator()(i,r) = CovS->operator()(i,r) / CovD->operator()(i);
+      }
+    }
+    // VW = V * W once, then CovI(i,j) = dij/D(i) - sum_r V(i,r) * VW(j,r)
+    FillZero(&WrkMat[5], InpEst, NRank);
+    TMatrixD *VW = WrkMat[5];
+    Double_t Sum;
+    for(Int_t j = 0; j<InpEst; j++){
+      for(Int_t r = 0; r<NRank; r++){
+	Sum = 0;
+	for(Int_t q = 0; q<NRank; q++){
+	  Sum = Sum + V->operator()(j,q) * W->operator()(q,r);
+	}
+	VW->operator()(j,r) = Sum;
+      }
+    }
+    for(Int_t i = 0; i<InpEst; i++){
+      for(Int_t j = i; j<InpEst; j++){
+	Sum = 0;
+	for(Int_t r = 0; r<NRank; r++){
+	  Sum = Sum + V->operator()(i,r) * VW->operator()(j,r);
+	}
+	if(i == j)Sum = Sum - 1. / CovD->operator()(i);
+	CovI->operator()(i,j) = -Sum;
+	CovI->operator()(j,i) = -Sum;
+      }
+    }
+    VW = NULL;
+    V = NULL;
+    W = NULL;
+
+  // Factorise Cov = L * LT and invert from the factor. This only
+  // works for a positive definite covariance. Otherwise, e.g. for the
+  // extreme correlations scanned in SolveMaxVar(), keep the general
+  // inversion such that the result can still be inspected.
+  }else if(CalcCholesky(Cov, CovL) == 1){
+    SetPosDefCov(1);
+    CalcCholInvert(CovL, CovI);
+  }else{
+    SetPosDefCov(0);
+    if(IsPrintLevel() >= 2){
+      printf("... Blue->FillCovInvert(): Covariance is not positive definite \n");
+    }
+    CovI->SetSub(0,0,*Cov);
+    CovI->Invert();
+  }
   //printf("... Blue->FillCovInvert(): Inverse covariance \n"); CovI->Print();
 
   return;
 };
+
+//------------------------------------------------------------------------------
+
+Int_t Blue::FillCovLowRank(){
+  // The return value 1 / 0 = Cov = D + S * ST is used / not used
+  // This needs all active sources to be un-correlated, they sum up to D,
+  // or fully correlated, each of them is one column of S. It is only used
+  // if the number of columns is smaller than the number of estimates.
+  Int_t NRank = 0;
+  for(Int_t k = 0; k<InpUnc; k++){
+    if(CorTyp[k] == 1){
+      NRank = NRank + 1;
+    }else if(CorTyp[k] != 0){
+      return 0;
+    }
+  }
+  if(NRank >= InpEst)return 0;
+
+  // For a diagonal covariance keep one empty column
+  Int_t NCols = NRank;
+  if(NCols == 0)NCols = 1;
+  FillZero(&CovD, InpEst);
+  FillZero(&CovS, InpEst, NCols);
+  FillZero(&CovW, NCols, NCols);
+  FillZero(&CovT, NCols, 1);
+
+  // Fill D and S, D needs to be positive
+  Int_t r = 0;
+  for(Int_t k = 0; k<InpUnc; k++){
+    for(Int_t i = 0; i<InpEst; i++){
+      if(CorTyp[k] == 0){
+	CovD->operator()(i) = CovD->operator()(i) + 
+	  Unc->operator()(i+k*InpEst) * Unc->operator()(i+k*InpEst);
+      }else{
+	CovS->operator()(i,r) = Unc->operator()(i+k*InpEst);
+      }
+    }
+    if(CorTyp[k] == 1)r = r + 1;
+  }
+  for(Int_t i = 0; i<InpEst; i++){
+    // The negated test also catches a NaN diagonal
+    if(!(CovD->operator()(i) > 0))return 0;
+  }
+  //printf("... Blue->FillCovLowRank(): D \n"); CovD->Print();
+  //printf("... Blue->FillCovLowRank(): S \n"); CovS->Print();
+
+  // Factorise the small matrix (1 + ST * D-1 * S)
+  FillZero(&WrkMat[5], NCols, NCols);
+  TMatrixD *C = WrkMat[5];
+  Double_t Sum;
+  for(Int_t q = 0; q<NCols; q++){
+    for(Int_t p = q; p<NCols; p++){
+      Sum = 0;
+      for(Int_t i = 0; i<InpEst; i++){
+	Sum = Sum + CovS->operator()(i,p) * CovS->operator()(i,q) / CovD->operator()(i);
+      }
+      if(p == q)Sum = Sum + 1.;
+      C->operator()(p,q) = Sum;
+      C->operator()(q,p) = Sum;
+    }
+  }
+  Int_t IRet = CalcCholesky(C, CovW);
+  C = NULL;
+  return IRet;
+};
  
 //------------------------------------------------------------------------------
 
 void Blue::FillSig(){
   // Reset the uncertainty vector
-  Sig->Delete(); Sig = new TVectorD(InpEst);
+  FillZero(&Sig, InpEst);
   for(Int_t i = 0; i<InpEst; i++){
     Sig->operator()(i) = sqrt(Cov->operator()(i,i));
   }
@@ -7006,7 +8524,7 @@ void Blue::FillSig(){
 
 void Blue::FillRho(){
   // Reset the correlation matrix
-  Rho->Delete(); Rho = new TMatrixD(InpEst,InpEst);
+  FillZero(&Rho, InpEst, InpEst);
   Rho->operator=(*Cov);
   //Rho->Print();
   for(Int_t i = 0; i<InpEst; i++){
@@ -7023,6 +8541,194 @@ void Blue::FillRho(){
   return;
 };
 
+//------------------------------------------------------------------------------
+
+Int_t Blue::FillScaBase(const TMatrixD *UseFac, const TMatrixD *UseFij){
+  // The return value 1 / 0 = base is / is not available
+  // The base for the low rank updates in CalcScaRho() for the fixed input with
+  // the correlations scaled by UseFac and futched by UseFij. It stores Cov-1
+  // and Cov-1 * U, which is only done for a positive definite covariance.
+  // If the new base differs from a valid old one by a low rank update, as for
+  // the pairs of SolveMaxVar(2), Cov-1 is updated in O(N^2*r). To limit the
+  // accumulation of rounding errors it is re-calculated every InpEst updates.
+  Int_t NumCha = 0, IUpd = 0;
+  Int_t *LisCha = &WrkInt[InpUncOrig];
+  if(IsLowRankScan() == 1 && ScaBas == 1 && ScaUpd < InpEst){
+    NumCha = CalcScaCha(UseFac, UseFij, LisCha);
+    if(2*NumCha <= InpEst)IUpd = 1;
+  }
+  if(IUpd == 1 && NumCha > 0){
+    // Cov-1 = Cov0-1 - Cov0-1*P * D*S-1 * PT*Cov0-1
+    FillZero(&WrkMat[20], NumCha, NumCha);
+    FillZero(&WrkMat[21], NumCha, NumCha);
+    FillZero(&WrkMat[22], NumCha, InpEst);
+    FillZero(&WrkMat[23], NumCha, InpEst);
+    TMatrixD *D = WrkMat[20];
+    TMatrixD *S = WrkMat[21];
+    TMatrixD *Y = WrkMat[22];
+    TMatrixD *Z = WrkMat[23];
+    if(CalcScaCap(UseFac, UseFij, NumCha, LisCha, D, S) == 1){
+      for(Int_t a = 0; a<NumCha; a++){
+	for(Int_t j = 0; j<InpEst; j++){
+	  Y->operator()(a,j) = BasCovI->operator()(LisCha[a],j);
+	}
+      }
+      Z->Mult(*S, *Y);
+      Y->Mult(*D, *Z);
+      Double_t Sum = 0;
+      for(Int_t i = 0; i<InpEst; i++){
+	for(Int_t j = 0; j<InpEst; j++){
+	  Sum = 0;
+	  for(Int_t a = 0; a<NumCha; a++){
+	    Sum = Sum + BasCovI->operator()(i,LisCha[a]) * Y->operator()(a,j);
+	  }
+	  Z->operator()(0,j) = BasCovI->operator()(i,j) - Sum;
+	}
+	for(Int_t j = 0; j<InpEst; j++){
+	  BasCovI->operator()(i,j) = Z->operator()(0,j);
+	}
+      }
+      BasCovU->Mult(*BasCovI, *Uma);
+      ScaUpd = ScaUpd + 1;
+    }else{
+      IUpd = 0;
+    }
+    D = NULL;
+    S = NULL;
+    Y = NULL;
+    Z = NULL;
+  }
+  LisCha = NULL;
+  if(IUpd == 0){
+    FillZero(&BasCovI, InpEst, InpEst);
+    FillZero(&BasCovU, InpEst, InpObs);
+    ScaBas = 0;
+    ScaUpd = 0;
+    FillZero(&WrkMat[24], InpEst, InpEst);
+    FillZero(&WrkMat[25], InpEst, InpEst);
+    TMatrixD *C = WrkMat[24];
+    TMatrixD *L = WrkMat[25];
+    CalcScaCov(UseFac, UseFij, C);
+    if(CalcCholesky(C, L) == 1){
+      CalcCholInvert(L, BasCovI);
+      BasCovU->Mult(*BasCovI, *Uma);
+      ScaBas = 1;
+    }
+    C = NULL;
+    L = NULL;
+  }
+  FillZero(&BasFac, InpUncOrig, InpFac);
+  BasFac->SetSub(0,0,*UseFac);
+  ScaFut = 0;
+  if(UseFij != NULL){
+    FillZero(&BasFij, InpEstOrig, InpEstOrig);
+    BasFij->SetSub(0,0,*UseFij);
+    ScaFut = 1;
+  }
+  return ScaBas;
+};
+
+//------------------------------------------------------------------------------
+
+void Blue::FillChiBase(){
+  // The base for CalcChiRes() for the present covariance
+  // 1) The inverse of Cov from its Cholesky factor L and ln(det(Cov)) = 2*sum
+  //    ln(L(i,i)). The Gaussian case then only needs EET * Cov-1 * EE per
+  //    point. ChiFac = 1 / -1 = available / not possible for a not positive
+  //    definite covariance.
+  // 2) The covariance of all absolute uncertainties. For the likelihood with
+  //    relative uncertainties only their contributions are added per point.
+  // 3) The workspace 30-33 of CalcChiRes(), shaped here such that the
+  //    evaluations do not allocate.
+  FillZero(&ChiCov, InpEst, InpEst);
+  FillZero(&ChiCovI, InpEst, InpEst);
+  FillZero(&WrkMat[30], InpEst, InpEst);
+  FillZero(&WrkMat[31], InpEst, InpEst);
+  FillZero(&WrkMat[32], InpEst, 1);
+  FillZero(&WrkMat[33], InpEst, 1);
+  TMatrixD *L = WrkMat[30];
+  ChiFac = -1;
+  ChiDet = 0;
+  if(CalcCholesky(Cov, L) == 1){
+    for(Int_t i = 0; i<InpEst; i++)ChiDet = ChiDet + 2*TMath::Log(L->operator()(i,i));
+    CalcCholInvert(L, ChiCovI);
+    ChiFac = 1;
+  }
+  L = NULL;
+  for(Int_t k = 0; k<InpUnc; k++){
+    if(IsRelValUnc(IsWhichUnc(k)) == 0){
+      for(Int_t i = 0; i<InpEst; i++){
+	for(Int_t j = 0; j<InpEst; j++){
+	  ChiCov->operator()(i,j) = ChiCov->operator()(i,j) + 
+	    Unc->operator()(i+k*InpEst) * Cor[k]->operator()(i,j) * Unc->operator()(j+k*InpEst);
+	}
+      }
+    }
+  }
+  return;
+};
+
+//------------------------------------------------------------------------------
+
+void Blue::FillZero(TMatrixD **Mat, const Int_t NRows, const Int_t NCols){
+  // Reset *Mat to a zero NRows x NCols matrix, it is only allocated if it
+  // is NULL or the shape changed
+  FillZero(Mat, NRows, NCols, &NumAll);
+  return;
+};
+
+//------------------------------------------------------------------------------
+
+void Blue::FillZero(TMatrixD **Mat, const Int_t NRows, const Int_t NCols, Int_t *NumAlo) const {
+  // As above counting in *NumAlo, for the slots of CalcScaRho()
+  if(*Mat != NULL && (*Mat)->GetNrows() == NRows && (*Mat)->GetNcols() == NCols){
+    (*Mat)->Zero();
+    return;
+  }
+  delete *Mat; *Mat = new TMatrixD(NRows,NCols);
+  *NumAlo = *NumAlo + 1;
+  return;
+};
+
+//------------------------------------------------------------------------------
+
+void Blue::FillZero(TVectorD **Vec, const Int_t NRows){
+  // As above for a vector
+  if(*Vec != NULL && (*Vec)->GetNrows() == NRows){
+    (*Vec)->Zero();
+    return;
+  }
+  delete *Vec; *Vec = new TVectorD(NRows);
+  NumAll = NumAll + 1;
+  return;
+};
+
+//------------------------------------------------------------------------------
+
+void Blue::FillSloWrk(const Int_t NumSlo){
+  // Provide at least NumSlo slots for CalcScaRho(), existing ones are kept
+  if(NumSlo <= SloMax)return;
+  TMatrixD** NewMat = new TMatrixD*[NumSlo*SloNum];
+  Int_t*     NewInt = new Int_t[NumSlo*InpEstOrig];
+  Int_t*     NewAll = new Int_t[NumSlo];
+  for(Int_t q = 0; q<NumSlo; q++){
+    for(Int_t w = 0; w<SloNum; w++){
+      if(q < SloMax){
+	NewMat[q*SloNum+w] = SloMat[q*SloNum+w];
+      }else{
+	NewMat[q*SloNum+w] = NULL;
+      }
+    }
+    NewAll[q] = 0;
+    if(q < SloMax)NewAll[q] = SloAll[q];
+  }
+  delete [] SloMat; SloMat = NewMat;
+  delete [] SloInt; SloInt = NewInt;
+  delete [] SloAll; SloAll = NewAll;
+  SloMax = NumSlo;
+  return;
+};
+
 //------------------------------------------------------------------------------
 // Getters
 //------------------------------------------------------------------------------
@@ -7096,6 +8802,8 @@ Int_t Blue::IsIndexEst(const Int_t i) const {
     printf("... Blue->IsIndexEst(%2i): Not a defined estimate \n", i);
     return -1;
   }
+  // Not an active one
+  return -1;
 };
 
 //------------------------------------------------------------------------------
@@ -7235,6 +8943,8 @@ Int_t Blue::IsIndexUnc(const Int_t k) const {
     printf("... Blue->IsIndexUnc(%2i): Not a defined uncertainty \n", k);
     return -1;
   }
+  // Not an active one
+  return -1;
 };
 
 //------------------------------------------------------------------------------
@@ -7283,6 +8993,8 @@ Int_t Blue::IsIndexObs(const Int_t n) const {
     printf("... Blue->IsIndexObs(%2i): Not a defined observable \n", n);
     return -1;
   }
+  // Not an active one
+  return -1;
 };
 
 //------------------------------------------------------------------------------
@@ -7358,6 +9070,24 @@ Int_t Blue::IsCalcedParams() const {
 
 //------------------------------------------------------------------------------
 
+Int_t Blue::IsPosDefCov() const {
+  return IsPosDef;
+};
+
+//------------------------------------------------------------------------------
+
+Int_t Blue::IsLowRankCov() const {
+  return IsLowRank;
+};
+
+//------------------------------------------------------------------------------
+
+Int_t Blue::IsLowRankScan() const {
+  return ScaLow;
+};
+
+//------------------------------------------------------------------------------
+
 Int_t Blue::IsSolved() const {
   if(IsSolve == 1){
     return 1;
@@ -7449,9 +9179,23 @@ Int_t Blue::IsSolvedMaxVar() const {
 
 //------------------------------------------------------------------------------
 
+Int_t Blue::IsSolvedSensit() const {
+  if(IsSolveSensit == 1){
+    return 1;
+  }else{
+    if(IsPrintLevel() >= 2){
+      printf("... Blue->IsSolvedSensit(): Not yet solved Call SolveSensitivity() \n");
+    }
+    return 0;
+  }
+};
+
+//------------------------------------------------------------------------------
+
 Int_t Blue::IsSolvedAnyWay() const {
   if(IsSolve == 1 || IsSolveRelUnc == 1 || IsSolveAccImp == 1 || 
-     IsSolveInfWei == 1 || IsSolvePosWei == 1 || IsSolveMaxVar == 1){
+     IsSolveInfWei == 1 || IsSolvePosWei == 1 || IsSolveMaxVar == 1 ||
+     IsSolveSensit == 1){
     return 1;
   }else{
     if(IsPrintLevel() >= 2){
@@ -7472,6 +9216,15 @@ Int_t Blue::IsInspectedLike() const {
 
 //------------------------------------------------------------------------------
 
+Int_t Blue::IsInspectedToys() const {
+  if(IsInspectToys == 0 && IsPrintLevel() >= 2){
+    printf("... Blue->IsInspectedToys(): Not yet done Call InspectToys() \n");
+  }
+  return IsInspectToys;
+};
+
+//------------------------------------------------------------------------------
+
 Int_t Blue::IsRelValUnc() const {
   if(IsRelUncMode == 1){
     return 1;
@@ -7535,8 +9288,8 @@ Int_t Blue::GetMatEigen(const TMatrixD *TryMat) const {
 
   // Clean up
   delete EMatrix; EMatrix = NULL;
-  EValues->Delete(); EValues = NULL;
-  EVector->Delete(); EVector = NULL;
+  delete EValues; EValues = NULL;
+  delete EVector; EVector = NULL;
   
   return ISign;
 };
@@ -7551,11 +9304,13 @@ void Blue::SetActiveEst(const Int_t i, const Int_t l){
       if(IsPrintLevel() >= 2){
 	printf("... Blue->SetActiveEst(%2i,0): Deactivate estimate \n", i);
       }
+      if(EstAct[i] != 0)InpDir = 1;
       EstAct[i] = 0;
     }else if(l == 1){
       if(IsPrintLevel() >= 2){
 	printf("... Blue->SetActiveEst(%2i,l):   Activate estimate \n", i);
       }
+      if(EstAct[i] != 1)InpDir = 1;
       EstAct[i] = 1;
     }else{
       printf("... Blue->SetActiveEst(%2i,%2i): IGNORED Only 1/0 = active/inactive are allowed \n", i,l);
@@ -7585,11 +9340,13 @@ void Blue::SetActiveUnc(const Int_t k, const Int_t l){
       if(IsPrintLevel() >= 2){
 	printf("... Blue->SetActiveUnc(%2i,0): Deactivate uncertainty \n", k);
       }
+      if(UncAct[k] != 0)InpDir = 1;
       UncAct[k] = 0;
     }else if(l == 1){
       if(IsPrintLevel() >= 2){
 	printf("... Blue->SetActiveUnc(%2i,l):   Activate uncertainty \n", k);
       }
+      if(UncAct[k] != 1)InpDir = 1;
       UncAct[k] = 1;
     }else{
       printf("... Blue->SetActiveUnc(%2i,%2i): IGNORED Only 1/0 = active/inactive allowed \n",k,l);
@@ -7630,6 +9387,7 @@ void Blue::SetRhoValUnc(const Int_t k, const Int_t l, const Double_t RhoVal, con
 	}
 	UncCha[k] = m;
         ActFac->operator()(k,l) = 1.0;
+	UncDir[k] = 1;
       }else if(m == 1){
 	if(IsRhoFacUnc(k) == 1 || IsRhoRedUnc(k) == 1){
 	  printf("... Blue->SetRhoValUnc(%2i,%5.3f,%2i): IGNORED Only one of -Changed- -Scaled =%2i- or -Reduced =%2i- possible \n", 
@@ -7641,6 +9399,7 @@ void Blue::SetRhoValUnc(const Int_t k, const Int_t l, const Double_t RhoVal, con
 	}
 	UncCha[k] = m;
         ActFac->operator()(k,l) = RhoVal;
+	UncDir[k] = 1;
       }
     }else{
       printf("... Blue->SetRhoValUnc(%2i): IGNORED not an active uncertainty \n", k);
@@ -7669,6 +9428,7 @@ void Blue::SetRhoFacUnc(const Int_t k, const Int_t l, const Double_t RhoFac, con
 	}
 	UncFac[k] = m;
         ActFac->operator()(k,l) = 1.0;
+	UncDir[k] = 1;
       }else if(m == 1){
 	if(IsRhoValUnc(k) == 1 || IsRhoRedUnc(k) == 1){
 	  printf("... Blue->SetRhoFacUnc(%2i,%5.3f,%2i): IGNORED Only one of -Changed =%2i- -Scaled- or -Reduced =%2i- possible \n", 
@@ -7680,6 +9440,7 @@ void Blue::SetRhoFacUnc(const Int_t k, const Int_t l, const Double_t RhoFac, con
 	}
 	UncFac[k] = m;
         ActFac->operator()(k,l) = RhoFac;
+	UncDir[k] = 1;
       }
     }else{
       printf("... Blue->SetRhoFacUnc(%2i): IGNORED not an active uncertainty \n", k);
@@ -7699,6 +9460,7 @@ void Blue::SetRhoRedUnc(const Int_t k, const Int_t l){
 	printf("... Blue->SetRhoRedUnc(%2i,0): I remove the reduced correlations for this uncertainty \n", k);
       }
       UncRed[k] = l;
+      UncDir[k] = 1;
     }else if(l == 1){
       if(IsRhoValUnc(k) == 1 || IsRhoFacUnc(k) == 1){
 	printf("... Blue->SetRhoRedUnc(%2i,%2i): IGNORED Only one of -Changed =%2i- -Scaled =%2i- or -Reduced- possible \n", 
@@ -7709,6 +9471,7 @@ void Blue::SetRhoRedUnc(const Int_t k, const Int_t l){
 	printf("... Blue->SetRhoRedUnc(%2i,l): Set reduced correlations for this uncertainty \n", k);
       }
       UncRed[k] = l;
+      UncDir[k] = 1;
     }else{
       printf("... Blue->SetRhoRedUnc(%2i,%2i): IGNORED Only 1/0 = active/inactive allowed \n",k,l);
     }
@@ -7743,7 +9506,10 @@ void Blue::SetFilledInp(){
     XvaOrig->operator=(*Xva);
     SigOrig->operator=(*Sig);
     UncOrig->operator=(*Unc);
-    CorOrig->operator=(*Cor);
+    for(Int_t k = 0; k<InpUncOrig; k++){
+      CorOrig[k]->operator=(*Cor[k]);
+      CorTypOrig[k] = CorTyp[k];
+    }
     UmaOrig->operator=(*Uma);
     UtrOrig->operator=(*Utr);
 
@@ -7755,8 +9521,6 @@ void Blue::SetFilledInp(){
     // Much simpler see above
     //Xva->GetSub(0, InpEstOrig-1, *XvaOrig, "S");
     //Sig->GetSub(0, InpEstOrig-1, *SigOrig, "S");
-    //Unc->GetSub(0, InpEstOrig*InpUncOrig-1, 0, InpEstOrig*InpUncOrig-1, *UncOrig, "S");
-    //Cor->GetSub(0, InpEstOrig*InpUncOrig-1, 0, InpEstOrig*InpUncOrig-1, *CorOrig, "S");
     //Uma->GetSub(0, InpEstOrig-1, 0, InpObsOrig-1, *UmaOrig, "S");
     //Utr->GetSub(0, InpObsOrig-1, 0, InpEstOrig-1, *UtrOrig, "S");
 
@@ -7795,6 +9559,24 @@ void Blue::SetCalcedParams(const Int_t l){
 
 //------------------------------------------------------------------------------
 
+void Blue::SetPosDefCov(const Int_t l){
+  IsPosDef = l;
+};
+
+//------------------------------------------------------------------------------
+
+void Blue::SetLowRankCov(const Int_t l){
+  IsLowRank = l;
+};
+
+//------------------------------------------------------------------------------
+
+void Blue::SetLowRankScan(const Int_t l){
+  ScaLow = l;
+};
+
+//------------------------------------------------------------------------------
+
 void Blue::SetFutchCor(const Int_t i, const Int_t j, const Int_t l, const Double_t RhoFut){
   if(IsFixedInp() == 1){
     printf("... Blue->SetFutchCor(%2i): IGNORED input not yet released.", l);
@@ -7802,6 +9584,11 @@ void Blue::SetFutchCor(const Int_t i, const Int_t j, const Int_t l, const Double
     return;
   }
 
+  // Flag the changed correlations, all but the first source
+  if(l == 1 || IFuCor == 1){
+    for(Int_t k = 1; k<InpUncOrig; k++)UncDir[k] = 1;
+  }
+
   // Fill the matrix and set the flag
   if(l == 1){
     if(i == j){
@@ -7810,7 +9597,7 @@ void Blue::SetFutchCor(const Int_t i, const Int_t j, const Int_t l, const Double
       RhoFij->operator()(i,j) = RhoFut;
       RhoFij->operator()(j,i) = RhoFij->operator()(i,j);
     }
-  }else{
+  }else if(RhoFij != NULL){
     RhoFij->operator()(i,j) = 1;
   }
   IFuCor = l;
@@ -7833,7 +9620,7 @@ Double_t Blue::CalcRelUnc(const Int_t i, const Int_t k, const Double_t ValCom) c
   // The default scaling
   if(IsRelValUnc(k) == 1){
     Int_t IRow = i*InpUncOrig + k;
-    UncCom = Cof->operator()(IRow,0) + Cof->operator()(IRow,1)*TMath::Abs(ValCom) + Cof->operator()(IRow,2)*ValCom*ValCom;
+    UncCom = CalcRelVar(i, k, ValCom);
     if(UncCom < 0){
       printf("... Blue->CalcRelUnc(%2i, %2i, %5.3f): Unphysical Uncertainty = %5.3f is smaller than zero", i, k, ValCom,UncCom);
       printf("==> No combination will be performed \n");
@@ -7854,6 +9641,15 @@ Double_t Blue::CalcRelUnc(const Int_t i, const Int_t k, const Double_t ValCom) c
 
 //------------------------------------------------------------------------------
 
+Double_t Blue::CalcRelVar(const Int_t i, const Int_t k, const Double_t ValCom) const{
+  // The variance of the scaled uncertainty k of estimate i, may be negative
+  Int_t IRow = i*InpUncOrig + k;
+  return Cof->operator()(IRow,0) + Cof->operator()(IRow,1)*TMath::Abs(ValCom) +
+    Cof->operator()(IRow,2)*ValCom*ValCom;
+};
+
+//------------------------------------------------------------------------------
+
 Double_t Blue::Likelihood(const Double_t *x, const Double_t *par) const {
 
   //------------------------------------------------------------------------------
@@ -7875,68 +9671,150 @@ Double_t Blue::Likelihood(const Double_t *x, const Double_t *par) const {
   // The dimension of the Gauss == The number of estimates
   Double_t d = par[1];
   
-  // Get the Matrix that holds:
-  // 0,0 = the chi squared for the likelihood 
-  // 1,0 = the determinant of the covariance matrix
+  // Get the array that holds:
+  // 0 = the chi squared for the likelihood 
+  // 1 = the determinant of the covariance matrix
+  // 2 = its logarithm
   Int_t IsLike = static_cast<Int_t>(par[2]);
-  CalcChiRes(n, IsLike, x[0]);
-  //PrintMatrix(ChiRes,"%8.4f");
+  Double_t ChiRes[3];
+  CalcChiRes(n, IsLike, x[0], ChiRes);
+  //printf("... Blue->Likelihood(): %8.4f %8.4f %8.4f \n", ChiRes[0], ChiRes[1], ChiRes[2]);
 
   // Calculate the factors in front of the Gauss
   Double_t PiiFac = 1. / TMath::Power(2*TMath::ACos(-1.),d/2);
-  Double_t DetFac = 1. / TMath::Sqrt(ChiRes->operator()(1,0));
+  Double_t DetFac = TMath::Exp(-0.5*ChiRes[2]);
   
   // Return the Gauss
-  return PiiFac*DetFac*TMath::Exp(-0.5*ChiRes->operator()(0,0));
+  return PiiFac*DetFac*TMath::Exp(-0.5*ChiRes[0]);
 };
 
 //------------------------------------------------------------------------------
 
-void Blue::CalcChiRes(const Int_t n, const Int_t IsLike, const Double_t xt) const {
+void Blue::CalcChiRes(const Int_t n, const Int_t IsLike, const Double_t xt, Double_t *RetChi) const {
 
   // If IsLike == 0/1 <==> BLUE Gaussian / Likelihood
   // If IsRela == 0/1 <==> Absolute / relative uncertainties
   // Calculate covariance for IsLike == IsRela == 1 and IsSolvedRelUnc
   // else use the existing one
+  // RetChi[0-2] = Chiq, det(V) and ln(det(V)). The temporaries are taken
+  // from the workspace shaped by FillChiBase(), such that the likelihood of
+  // one object is evaluated by one thread at a time, as in InspectLike().
 
   // Check if at least one relative uncertainty exist
   Int_t IsRela = 0;
   for(Int_t k = 0; k<InpUncOrig; k++)if(IsRelValUnc(k) == 1)IsRela = 1;
 
-  // Define the matrices to work with
-  TMatrixD *EE = new TMatrixD(InpEst,1);
-  TMatrixD *ET = new TMatrixD(1,InpEst);
-  TMatrixD *CO = new TMatrixD(InpEst, InpEst);
-  TMatrixD *CI = new TMatrixD(InpEst, InpEst);
-  TMatrixD *DU = new TMatrixD(InpEst, 1);
-  TMatrixD *VA = new TMatrixD(1, 1);
-
-  // Fill the vectors with difference of:
-  // Estimate and         xt for obs == n
-  // Estimate and observable for obs != n
-  Int_t na;
-  for(Int_t i = 0; i<InpEst; i++){
-    if(EstWhichObs(IsWhichEst(i)) == n){
-      EE->operator()(i,0) = Xva->operator()(i) - xt;
-    }else{
-      na = IsIndexObs(EstWhichObs(IsWhichEst(i)));
-      EE->operator()(i,0) = Xva->operator()(i) - XvaRes->operator()(na);      
-    }
-    ET->operator()(0,i) = EE->operator()(i,0);
-  }
-  // printf("... Blue->CalcChiRes(): EE, ET \n"); EE->Print(); ET->Print();
+  // The differences of the estimates to xt for obs == n and to the combined
+  // value for obs != n
+  Double_t xi = 0, xj = 0;
 
-  // Calculate covariance as a function of xt
-  Double_t Sigik = 0, Sigjk = 0, Rhova = 0, xi = 0, xj = 0;
-  Int_t    io = 0, jo = 0, ko = 0, no = 0;
-  if(IsLike == 1 && IsRela == 1){
+  // With the base of FillChiBase() Chiq = EET * Cov-1 * EE without any
+  // allocation. For the likelihood with relative uncertainties the covariance
+  // is the stored absolute part plus the relative sources at xt, factorised
+  // anew, and Chiq = |L-1 * EE|^2.
+  if(ChiFac == 1 && (IsLike == 0 || IsRela == 0)){
+    Double_t Chiq = 0;
     for(Int_t i = 0; i<InpEst; i++){
-      io = IsWhichEst(i);
-      no = EstWhichObs(io);
       xi = xt;
-      if(no != n)xi = XvaRes->operator()(IsIndexObs(EstWhichObs(IsWhichEst(i))));
-      for(Int_t j = i; j<InpEst; j++){
-	jo = IsWhichEst(j);
+      if(EstWhichObs(IsWhichEst(i)) != n)xi = XvaRes->operator()(IsIndexObs(EstWhichObs(IsWhichEst(i))));
+      xi = Xva->operator()(i) - xi;
+      Chiq = Chiq + ChiCovI->operator()(i,i) * xi * xi;
+      for(Int_t j = i+1; j<InpEst; j++){
+	xj = xt;
+	if(EstWhichObs(IsWhichEst(j)) != n)xj = XvaRes->operator()(IsIndexObs(EstWhichObs(IsWhichEst(j))));
+	xj = Xva->operator()(j) - xj;
+	Chiq = Chiq + 2 * ChiCovI->operator()(i,j) * xi * xj;
+      }
+    }
+    RetChi[0] = Chiq;
+    RetChi[1] = TMath::Exp(ChiDet);
+    RetChi[2] = ChiDet;
+    return;
+  }else if(ChiFac == 1){
+    // The uncertainties of a relative source depend on xt, its entries are
+    // added to the absolute part, the off-diagonal ones only if the source
+    // is correlated. S keeps its uncertainties at xt.
+    TMatrixD *L = WrkMat[30];
+    TMatrixD *C = WrkMat[31];
+    TMatrixD *S = WrkMat[32];
+    C->operator=(*ChiCov);
+    for(Int_t k = 0; k<InpUnc; k++){
+      if(IsRelValUnc(IsWhichUnc(k)) == 1){
+	for(Int_t i = 0; i<InpEst; i++){
+	  xi = xt;
+	  if(EstWhichObs(IsWhichEst(i)) != n)xi = XvaRes->operator()(IsIndexObs(EstWhichObs(IsWhichEst(i))));
+	  S->operator()(i,0) = CalcRelUnc(IsWhichEst(i), IsWhichUnc(k), xi);
+	  C->operator()(i,i) = C->operator()(i,i) + S->operator()(i,0) * S->operator()(i,0);
+	}
+	if(CorTyp[k] != 0){
+	  for(Int_t i = 0; i<InpEst; i++){
+	    for(Int_t j = i+1; j<InpEst; j++){
+	      C->operator()(i,j) = C->operator()(i,j) + 
+		Cor[k]->operator()(i,j) * S->operator()(i,0) * S->operator()(j,0);
+	      C->operator()(j,i) = C->operator()(i,j);
+	    }
+	  }
+	}
+      }
+    }
+    Int_t IBase = CalcCholesky(C, L);
+    if(IBase == 1){
+      // Forward substitution L * z = EE, Chiq = zT * z, z is kept in the
+      // first column of C
+      Double_t Sum = 0, Chiq = 0, Det = 0;
+      for(Int_t i = 0; i<InpEst; i++){
+	xi = xt;
+	if(EstWhichObs(IsWhichEst(i)) != n)xi = XvaRes->operator()(IsIndexObs(EstWhichObs(IsWhichEst(i))));
+	Sum = Xva->operator()(i) - xi;
+	for(Int_t j = 0; j<i; j++){
+	  Sum = Sum - L->operator()(i,j) * C->operator()(j,0);
+	}
+	C->operator()(i,0) = Sum / L->operator()(i,i);
+	Chiq = Chiq + C->operator()(i,0) * C->operator()(i,0);
+	Det = Det + 2*TMath::Log(L->operator()(i,i));
+      }
+      RetChi[0] = Chiq;
+      RetChi[1] = TMath::Exp(Det);
+      RetChi[2] = Det;
+    }
+    L = NULL;
+    C = NULL;
+    S = NULL;
+    if(IBase == 1)return;
+  }
+
+  // The matrices to work with from the workspace of FillChiBase()
+  TMatrixD *CI = WrkMat[30];
+  TMatrixD *CO = WrkMat[31];
+  TMatrixD *EE = WrkMat[32];
+  TMatrixD *DU = WrkMat[33];
+  CO->Zero();
+
+  // Fill the vectors with difference of:
+  // Estimate and         xt for obs == n
+  // Estimate and observable for obs != n
+  Int_t na;
+  for(Int_t i = 0; i<InpEst; i++){
+    if(EstWhichObs(IsWhichEst(i)) == n){
+      EE->operator()(i,0) = Xva->operator()(i) - xt;
+    }else{
+      na = IsIndexObs(EstWhichObs(IsWhichEst(i)));
+      EE->operator()(i,0) = Xva->operator()(i) - XvaRes->operator()(na);      
+    }
+  }
+  // printf("... Blue->CalcChiRes(): EE \n"); EE->Print();
+
+  // Calculate covariance as a function of xt
+  Double_t Sigik = 0, Sigjk = 0, Rhova = 0;
+  Int_t    io = 0, jo = 0, ko = 0, no = 0;
+  if(IsLike == 1 && IsRela == 1){
+    for(Int_t i = 0; i<InpEst; i++){
+      io = IsWhichEst(i);
+      no = EstWhichObs(io);
+      xi = xt;
+      if(no != n)xi = XvaRes->operator()(IsIndexObs(EstWhichObs(IsWhichEst(i))));
+      for(Int_t j = i; j<InpEst; j++){
+	jo = IsWhichEst(j);
 	no = EstWhichObs(jo);	
 	xj = xt;
 	if(no != n)xj = XvaRes->operator()(IsIndexObs(EstWhichObs(IsWhichEst(j))));
@@ -7947,7 +9825,7 @@ void Blue::CalcChiRes(const Int_t n, const Int_t IsLike, const Double_t xt) cons
 	    if(IsRelValUnc(ko) == 1){
 	      Sigik = CalcRelUnc(io, ko, xi);
 	    }else{
-	      Sigik = Unc->operator()(i+k*InpEst,i+k*InpEst);
+	      Sigik = Unc->operator()(i+k*InpEst);
 	    }
 	    CO->operator()(i,i) = CO->operator()(i,i) + Sigik * Sigik;
 	  }else{
@@ -7955,10 +9833,10 @@ void Blue::CalcChiRes(const Int_t n, const Int_t IsLike, const Double_t xt) cons
 	      Sigik = CalcRelUnc(io, ko, xi);
 	      Sigjk = CalcRelUnc(jo, ko, xj);
 	    }else{
-	      Sigik = Unc->operator()(i+k*InpEst,i+k*InpEst);
-	      Sigjk = Unc->operator()(j+k*InpEst,j+k*InpEst);
+	      Sigik = Unc->operator()(i+k*InpEst);
+	      Sigjk = Unc->operator()(j+k*InpEst);
 	    }
-	    Rhova = Cor->operator()(i+k*InpEst,j+k*InpEst);
+	    Rhova = Cor[k]->operator()(i,j);
 	    CO->operator()(i,j) = CO->operator()(i,j) + Rhova * Sigik * Sigjk;
 	  }
 	}
@@ -7978,39 +9856,372 @@ void Blue::CalcChiRes(const Int_t n, const Int_t IsLike, const Double_t xt) cons
 
   // Calculate ET * CI * EE 
   DU->Mult(*CI, *EE);
-  VA->Mult(*ET, *DU);
+  Double_t Chiq = 0;
+  for(Int_t i = 0; i<InpEst; i++)Chiq = Chiq + EE->operator()(i,0) * DU->operator()(i,0);
 
   // The results
-  ChiRes->operator()(0,0) = VA->operator()(0, 0);
-  ChiRes->operator()(1,0) = TMath::Abs(CO->Determinant());
+  RetChi[0] = Chiq;
+  RetChi[1] = TMath::Abs(CO->Determinant());
+  RetChi[2] = TMath::Log(RetChi[1]);
 
-  // Clean up matrices
-  EE->Delete(); EE = NULL;
-  ET->Delete(); ET = NULL;
-  CO->Delete(); CO = NULL;
-  CI->Delete(); CI = NULL;
-  DU->Delete(); DU = NULL;
-  VA->Delete(); VA = NULL;
+  // Release the workspace
+  CI = NULL;
+  CO = NULL;
+  EE = NULL;
+  DU = NULL;
 
   return;
 };
 
 //------------------------------------------------------------------------------
 
+Double_t Blue::CalcLikMax(const Int_t n, const Int_t IsLike, const Double_t xlow, const Double_t xhig) const {
+
+  // The x of the maximum of the likelihood in [xlow,xhig], see InspectLike().
+  // The best of 16 equidistant points brackets the maximum, and -2ln(L(x))
+  // is minimised around it by Brent's method, i.e. parabolic interpolation
+  // with golden section steps as fall back. The coarse grid only needs to
+  // find the right interval, Brent's method does the rest. All is evaluated
+  // here to not need a TF1 registered in gROOT.
+  Double_t par[3];
+  par[0] = static_cast<Double_t>(n);
+  par[1] = static_cast<Double_t>(InpEst);
+  par[2] = static_cast<Double_t>(IsLike);
+  const Int_t NumPoi = 16;
+  Double_t xste = (xhig - xlow) / NumPoi;
+
+  // The best grid point
+  Double_t x = xlow, fx = 0, fbes = 0, xbes = xlow;
+  for(Int_t i = 0; i<=NumPoi; i++){
+    x = xlow + i*xste;
+    fx = -2.*TMath::Log(Likelihood(&x, par));
+    if(i == 0 || fx < fbes){
+      fbes = fx;
+      xbes = x;
+    }
+  }
+
+  // Refine within its neighbours
+  const Double_t Gol = 0.3819660;
+  Double_t a = TMath::Max(xlow, xbes - xste), b = TMath::Min(xhig, xbes + xste);
+  Double_t Tol = 1.E-10 * TMath::Abs(xste);
+  Double_t v = xbes, w = xbes, fv = fbes, fw = fbes, fu = 0, u = 0;
+  Double_t d = 0, e = 0, xm = 0, Tol1 = 0, Tol2 = 0, p = 0, q = 0, r = 0;
+  x = xbes; fx = fbes;
+  for(Int_t Ite = 0; Ite<100; Ite++){
+    xm = 0.5*(a + b);
+    Tol1 = 1.E-15*TMath::Abs(x) + Tol;
+    Tol2 = 2*Tol1;
+    if(TMath::Abs(x - xm) <= Tol2 - 0.5*(b - a))break;
+    if(TMath::Abs(e) > Tol1){
+      // Try a parabolic step
+      r = (x - w)*(fx - fv);
+      q = (x - v)*(fx - fw);
+      p = (x - v)*q - (x - w)*r;
+      q = 2*(q - r);
+      if(q > 0)p = -p;
+      q = TMath::Abs(q);
+      r = e;
+      e = d;
+      if(TMath::Abs(p) >= TMath::Abs(0.5*q*r) || p <= q*(a - x) || p >= q*(b - x)){
+	if(x >= xm){
+	  e = a - x;
+	}else{
+	  e = b - x;
+	}
+	d = Gol*e;
+      }else{
+	d = p / q;
+	u = x + d;
+	if(u - a < Tol2 || b - u < Tol2)d = TMath::Sign(Tol1, xm - x);
+      }
+    }else{
+      // A golden section step
+      if(x >= xm){
+	e = a - x;
+      }else{
+	e = b - x;
+      }
+      d = Gol*e;
+    }
+    if(TMath::Abs(d) >= Tol1){
+      u = x + d;
+    }else{
+      u = x + TMath::Sign(Tol1, d);
+    }
+    fu = -2.*TMath::Log(Likelihood(&u, par));
+    //printf("... Blue->CalcLikMax(%2i): %2i %8.6f %12.9f \n", n, Ite, u, fu);
+    if(fu <= fx){
+      if(u >= x){
+	a = x;
+      }else{
+	b = x;
+      }
+      v = w; fv = fw;
+      w = x; fw = fx;
+      x = u; fx = fu;
+    }else{
+      if(u < x){
+	a = u;
+      }else{
+	b = u;
+      }
+      if(fu <= fw || w == x){
+	v = w; fv = fw;
+	w = u; fw = fu;
+      }else if(fu <= fv || v == x || v == w){
+	v = u; fv = fu;
+      }
+    }
+  }
+  return x;
+};
+
+//------------------------------------------------------------------------------
+
+Int_t Blue::CalcLikCro(const Int_t n, const Int_t IsLike, const Double_t xmax, const Double_t LogMax,
+		       const Double_t xend, const Double_t xbra, Double_t *xcro) const {
+
+  // The return value 1 / 0 = found / not found
+  // The first x from xmax towards xend with -2ln(L(x)) = LogMax + 1, see
+  // InspectLike(). The profile is walked in steps of xbra until the crossing
+  // is bracketed, which is then refined by Brent's method, i.e. inverse
+  // quadratic interpolation with bisection as fall back.
+  Double_t par[3];
+  par[0] = static_cast<Double_t>(n);
+  par[1] = static_cast<Double_t>(InpEst);
+  par[2] = static_cast<Double_t>(IsLike);
+  Double_t Dir = 1;
+  if(xend < xmax)Dir = -1;
+  Double_t Tol = 1.E-6 * TMath::Abs(xbra);
+
+  // Bracket the crossing in [a,b]
+  Double_t a = xmax, b = xmax, fa = -1, fb = -1;
+  *xcro = xend;
+  while(fb <= 0){
+    if(Dir*(b - xend) >= 0)return 0;
+    a = b;
+    fa = fb;
+    b = b + Dir*TMath::Abs(xbra);
+    if(Dir*(b - xend) > 0)b = xend;
+    fb = -2.*TMath::Log(Likelihood(&b, par)) - LogMax - 1;
+  }
+
+  // Find the root in [a,b]
+  Double_t c = b, fc = fb, d = 0, e = 0, xm = 0, Tol1 = 0;
+  Double_t p = 0, q = 0, r = 0, t = 0;
+  for(Int_t Ite = 0; Ite<100; Ite++){
+    if((fb > 0 && fc > 0) || (fb < 0 && fc < 0)){
+      c = a; fc = fa;
+      d = b - a; e = d;
+    }
+    if(TMath::Abs(fc) < TMath::Abs(fb)){
+      a = b; b = c; c = a;
+      fa = fb; fb = fc; fc = fa;
+    }
+    Tol1 = 2*1.E-15*TMath::Abs(b) + 0.5*Tol;
+    xm = 0.5*(c - b);
+    if(TMath::Abs(xm) <= Tol1 || fb == 0)break;
+    if(TMath::Abs(e) >= Tol1 && TMath::Abs(fa) > TMath::Abs(fb)){
+      // Try an inverse quadratic interpolation
+      t = fb / fa;
+      if(a == c){
+	p = 2*xm*t;
+	q = 1 - t;
+      }else{
+	q = fa / fc;
+	r = fb / fc;
+	p = t*(2*xm*q*(q - r) - (b - a)*(r - 1));
+	q = (q - 1)*(r - 1)*(t - 1);
+      }
+      if(p > 0)q = -q;
+      p = TMath::Abs(p);
+      if(2*p < TMath::Min(3*xm*q - TMath::Abs(Tol1*q), TMath::Abs(e*q))){
+	e = d;
+	d = p / q;
+      }else{
+	d = xm; e = d;
+      }
+    }else{
+      // A bisection step
+      d = xm; e = d;
+    }
+    a = b; fa = fb;
+    if(TMath::Abs(d) > Tol1){
+      b = b + d;
+    }else if(xm > 0){
+      b = b + Tol1;
+    }else{
+      b = b - Tol1;
+    }
+    fb = -2.*TMath::Log(Likelihood(&b, par)) - LogMax - 1;
+    //printf("... Blue->CalcLikCro(%2i): %2i %8.6f %12.9f \n", n, Ite, b, fb);
+  }
+  *xcro = b;
+  return 1;
+};
+
+//------------------------------------------------------------------------------
+
+void Blue::CalcLikGau(const Int_t n, Double_t *xmax, Double_t *xsig) const {
+
+  // For the Gaussian case with the covariance of Solve() the exponent of the
+  // likelihood of observable n, with all other observables at their combined
+  // values, is (a - u*x)T * Cov-1 * (a - u*x), with u(i) = 1 for the estimates
+  // of n and a the estimates reduced by the other combined values. It is
+  // maximal for xmax = uT*Cov-1*a / uT*Cov-1*u, and -2ln(L) rises by one at
+  // xmax +- 1/sqrt(uT*Cov-1*u).
+  Double_t UCU = 0, UCA = 0, Ai = 0;
+  for(Int_t i = 0; i<InpEst; i++){
+    Ai = Xva->operator()(i);
+    if(EstWhichObs(IsWhichEst(i)) != n){
+      Ai = Ai - XvaRes->operator()(IsIndexObs(EstWhichObs(IsWhichEst(i))));
+    }
+    for(Int_t j = 0; j<InpEst; j++){
+      if(EstWhichObs(IsWhichEst(j)) == n){
+	UCA = UCA + CovI->operator()(j,i) * Ai;
+	if(EstWhichObs(IsWhichEst(i)) == n)UCU = UCU + CovI->operator()(j,i);
+      }
+    }
+  }
+  *xmax = UCA / UCU;
+  *xsig = 1. / TMath::Sqrt(UCU);
+  return;
+};
+
+//------------------------------------------------------------------------------
+
+Double_t Blue::CalcToyGau(const UInt_t Seed, const ULong64_t Cnt) const {
+
+  // A standard normal number that only depends on Seed and the counter Cnt.
+  // Two uniform numbers are obtained by the SplitMix64 finaliser of the
+  // counters 2*Cnt and 2*Cnt+1 and are transformed by Box-Muller.
+  ULong64_t h[2];
+  Double_t u[2];
+  for(Int_t l = 0; l<2; l++){
+    h[l] = (static_cast<ULong64_t>(Seed) << 32) ^ (2*Cnt + l);
+    h[l] = h[l] * 0x9E3779B97F4A7C15ULL;
+    h[l] = (h[l] ^ (h[l] >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    h[l] = (h[l] ^ (h[l] >> 27)) * 0x94D049BB133111EBULL;
+    h[l] = h[l] ^ (h[l] >> 31);
+    u[l] = (static_cast<Double_t>(h[l] >> 11) + 0.5) / 9007199254740992.;
+  }
+  return TMath::Sqrt(-2*TMath::Log(u[0])) * TMath::Cos(2*TMath::Pi()*u[1]);
+};
+
+//------------------------------------------------------------------------------
+
+void Blue::CalcToys(const UInt_t Seed, const Long64_t ToyFir, const Int_t NumBat, const TMatrixD *L,
+		    const Int_t q) const {
+
+  // The NumBat toys ToyFir,... for InspectToys(). All are done at once by
+  // matrix products. The sums for InspectToys() are filled into the
+  // matrices 6-8 of slot q, AccRes, AccPul and AccPro, the chi squared is
+  // summed in AccPro(0,ToyBin). Only the workspace of slot q is written,
+  // see FillSloWrk(), such that the slots can run in parallel threads.
+  TMatrixD **Slo = &SloMat[q*SloNum];
+  FillZero(&Slo[0], InpEst, NumBat, &SloAll[q]);
+  FillZero(&Slo[1], InpEst, NumBat, &SloAll[q]);
+  FillZero(&Slo[2], InpObs, InpEst, &SloAll[q]);
+  FillZero(&Slo[3], InpObs, NumBat, &SloAll[q]);
+  FillZero(&Slo[4], InpEst, NumBat, &SloAll[q]);
+  FillZero(&Slo[5], InpEst, NumBat, &SloAll[q]);
+  FillZero(&Slo[6], InpObs, ToyDim, &SloAll[q]);
+  FillZero(&Slo[7], InpObs, ToyBin, &SloAll[q]);
+  FillZero(&Slo[8], 1, ToyBin+1, &SloAll[q]);
+  TMatrixD *Z = Slo[0];
+  TMatrixD *X = Slo[1];
+  TMatrixD *T = Slo[2];
+  TMatrixD *R = Slo[3];
+  TMatrixD *E = Slo[4];
+  TMatrixD *W = Slo[5];
+  TMatrixD *AccRes = Slo[6];
+  TMatrixD *AccPul = Slo[7];
+  TMatrixD *AccPro = Slo[8];
+
+  // The toys around the combined values
+  for(Int_t i = 0; i<InpEst; i++){
+    for(Int_t t = 0; t<NumBat; t++){
+      Z->operator()(i,t) = CalcToyGau(Seed, static_cast<ULong64_t>(ToyFir + t) * InpEst + i);
+    }
+  }
+  X->Mult(*L, *Z);
+  Double_t val = 0;
+  for(Int_t i = 0; i<InpEst; i++){
+    val = 0;
+    for(Int_t n = 0; n<InpObs; n++)val = val + Uma->operator()(i,n)*XvaRes->operator()(n);
+    for(Int_t t = 0; t<NumBat; t++)X->operator()(i,t) = X->operator()(i,t) + val;
+  }
+
+  // Combine them and get the chi squared of each
+  T->Transpose(*Lam);
+  R->Mult(*T, *X);
+  E->Mult(*Uma, *R);
+  E->operator-=(*X);
+  W->Mult(*CovI, *E);
+
+  // Fill the sums
+  Double_t DifToy = 0, PulToy = 0, SigToy = 0, Chq = 0, Pro = 0;
+  Int_t Bin = 0;
+  for(Int_t n = 0; n<InpObs; n++){
+    SigToy = TMath::Sqrt(CovRes->operator()(n,n));
+    for(Int_t t = 0; t<NumBat; t++){
+      DifToy = R->operator()(n,t) - XvaRes->operator()(n);
+      PulToy = DifToy / SigToy;
+      AccRes->operator()(n,0) = AccRes->operator()(n,0) + DifToy;
+      AccRes->operator()(n,1) = AccRes->operator()(n,1) + DifToy * DifToy;
+      AccRes->operator()(n,2) = AccRes->operator()(n,2) + PulToy;
+      AccRes->operator()(n,3) = AccRes->operator()(n,3) + PulToy * PulToy;
+      if(TMath::Abs(PulToy) < 1)AccRes->operator()(n,4) = AccRes->operator()(n,4) + 1;
+      if(TMath::Abs(PulToy) < 2)AccRes->operator()(n,5) = AccRes->operator()(n,5) + 1;
+      Bin = static_cast<Int_t>(TMath::Floor((PulToy + 4) / 8 * ToyBin));
+      if(Bin >= 0 && Bin < ToyBin)AccPul->operator()(n,Bin) = AccPul->operator()(n,Bin) + 1;
+    }
+  }
+  for(Int_t t = 0; t<NumBat; t++){
+    Chq = 0;
+    for(Int_t i = 0; i<InpEst; i++)Chq = Chq + E->operator()(i,t) * W->operator()(i,t);
+    AccPro->operator()(0,ToyBin) = AccPro->operator()(0,ToyBin) + Chq;
+    if(NumDof > 0){
+      Pro = TMath::Prob(Chq, NumDof);
+      Bin = TMath::Min(static_cast<Int_t>(Pro * ToyBin), ToyBin - 1);
+      AccPro->operator()(0,Bin) = AccPro->operator()(0,Bin) + 1;
+    }
+  }
+
+  // Clean up
+  Z = NULL;
+  X = NULL;
+  T = NULL;
+  R = NULL;
+  E = NULL;
+  W = NULL;
+  AccRes = NULL;
+  AccPul = NULL;
+  AccPro = NULL;
+  return;
+};
+
+//------------------------------------------------------------------------------
+
 void Blue::CalcParams(){
   //printf("... Blue->CalcParams(): Rho \n"); Rho->Print()
   //printf("... Blue->CalcParams(): Sig \n"); Sig->Print();
+
+  // Called by FixInp(), the sweep below keeps this cheap
   
-  // Reset matrices
-  SRat->Delete(); SRat = new TMatrixD(InpEstOrig,InpEstOrig);
-  Beta->Delete(); Beta = new TMatrixD(InpEstOrig,InpEstOrig);
-  Sigx->Delete(); Sigx = new TMatrixD(InpEstOrig,InpEstOrig);
-  DBdr->Delete(); DBdr = new TMatrixD(InpEstOrig,InpEstOrig);
-  DSdr->Delete(); DSdr = new TMatrixD(InpEstOrig,InpEstOrig);
-  DBdz->Delete(); DBdz = new TMatrixD(InpEstOrig,InpEstOrig);
-  DSdz->Delete(); DSdz = new TMatrixD(InpEstOrig,InpEstOrig);
+  // Shape and reset matrices
+  FillZero(&SRat, InpEstOrig, InpEstOrig);
+  FillZero(&Beta, InpEstOrig, InpEstOrig);
+  FillZero(&Sigx, InpEstOrig, InpEstOrig);
+  FillZero(&DBdr, InpEstOrig, InpEstOrig);
+  FillZero(&DSdr, InpEstOrig, InpEstOrig);
+  FillZero(&DBdz, InpEstOrig, InpEstOrig);
+  FillZero(&DSdz, InpEstOrig, InpEstOrig);
   
-  // Loop and fill lower half
+  // Collect the pairs of the same observable, lower half
+  std::vector<Int_t> PaiI, PaiJ;
+  std::vector<Double_t> PaiR, PaiZ;
   Double_t rho = 0, zva = 0;
   Int_t ii = 0, jj = 0;
   for(Int_t i = 0; i<InpEst; i++){
@@ -8022,28 +10233,921 @@ void Blue::CalcParams(){
 	jj = IsWhichEst(j);
 	SRat->operator()(jj,ii) = zva;
 	if(zva < 1)zva = 1/zva;
-	//printf("... Blue->CalcParams(): rho=%5.3f zva=%5.3f \n",rho,zva);
-	Beta->operator()(jj,ii) = GetPara(1, rho, zva);
-	Sigx->operator()(jj,ii) = GetPara(2, rho, zva);
-	DBdr->operator()(jj,ii) = GetPara(3, rho, zva);
-	DSdr->operator()(jj,ii) = GetPara(4, rho, zva);
-	DBdz->operator()(jj,ii) = GetPara(5, rho, zva);
-	DSdz->operator()(jj,ii) = GetPara(6, rho, zva);	 
+	PaiI.push_back(ii);
+	PaiJ.push_back(jj);
+	PaiR.push_back(rho);
+	PaiZ.push_back(zva);
+      }
+    }
+  }
+  Int_t NumPai = static_cast<Int_t>(PaiR.size());
+  if(NumPai == 0){
+    IsCalcParams = 1;
+    return;
+  }
+
+  // The formulae of GetPara(ifl = 1-6) in one sweep over all pairs without
+  // branches or print out, such that the compiler can vectorise it
+  std::vector<Double_t> ParBet(NumPai), ParSgx(NumPai), ParDbr(NumPai);
+  std::vector<Double_t> ParDsr(NumPai), ParDbz(NumPai), ParDsz(NumPai);
+  const Double_t *r = &PaiR[0];
+  const Double_t *z = &PaiZ[0];
+  Double_t nenn, nen3;
+  for(Int_t p = 0; p<NumPai; p++){
+    nenn = 1 - 2*r[p]*z[p] + z[p]*z[p];
+    nen3 = nenn*nenn*nenn;
+    ParBet[p] = (1 - r[p]*z[p])/nenn;
+    ParSgx[p] = sqrt(z[p]*z[p] * (1 - r[p]*r[p])/nenn);
+    ParDbr[p] = z[p]*(1 - z[p]*z[p])/(nenn*nenn);
+    ParDsr[p] = z[p] * (z[p] - r[p]) * (1 - r[p]*z[p]) / sqrt((1 - r[p]*r[p])*nen3);
+    ParDbz[p] = (r[p] * (1 + z[p]*z[p]) - 2*z[p])/(nenn*nenn);
+    ParDsz[p] = (1 - r[p]*z[p]) * sqrt((1 - r[p]*r[p])/nen3);
+  }
+
+  // Fill, with the validity of GetPara()
+  for(Int_t p = 0; p<NumPai; p++){
+    if((r[p] >= 0.9999 && TMath::Abs(1 - z[p]) <= 0.0001) || 
+       z[p] <=  0.9999 || r[p] <= -1.0001 || r[p] >= 1.0001){
+      printf("... GetPara(%5.3f,%5.3f): IGNORED Outside of validity \n", r[p], z[p]);
+      ParBet[p] = -99.;
+      ParSgx[p] = -99.;
+      ParDbr[p] = -99.;
+      ParDsr[p] = -99.;
+      ParDbz[p] = -99.;
+      ParDsz[p] = -99.;
+    }
+    ii = PaiI[p];
+    jj = PaiJ[p];
+    Beta->operator()(jj,ii) = ParBet[p];
+    Sigx->operator()(jj,ii) = ParSgx[p];
+    DBdr->operator()(jj,ii) = ParDbr[p];
+    DSdr->operator()(jj,ii) = ParDsr[p];
+    DBdz->operator()(jj,ii) = ParDbz[p];
+    DSdz->operator()(jj,ii) = ParDsz[p];
+  }
+  IsCalcParams = 1;
+  return;
+};
+
+//------------------------------------------------------------------------------
+
+Long64_t Blue::CalcMemory(const Int_t IGrp) const {
+
+  // The heap memory of the group IGrp of data members, see PrintMemory().
+  // Buffers of modes not yet used are NULL and do not count.
+  const Long64_t SizInt = sizeof(Int_t);
+  const Long64_t SizStr = sizeof(TString);
+  const Long64_t SizPtr = sizeof(TMatrixD*);
+  Long64_t Mem = 0;
+  if(IGrp == 0){
+    // Names, flags, lists and the save harbour of the input
+    Mem = Mem + 2*(InpEstOrig + InpUncOrig + InpObsOrig) * SizStr;
+    Mem = Mem + (5*InpEstOrig + 10*InpUncOrig + 2*InpObsOrig + 3) * SizInt;
+    Mem = Mem + 2*InpUncOrig * SizPtr;
+    Mem = Mem + CalcMemory(MatFac) + CalcMemory(ActFac) + CalcMemory(MinFac) + 
+      CalcMemory(MaxFac) + CalcMemory(Uma) + CalcMemory(Utr) + CalcMemory(Cof) + 
+      CalcMemory(HisRel) + CalcMemory(UmaOrig) + CalcMemory(UtrOrig) + CalcMemory(IndRel);
+    for(Int_t k = 0; k<InpUncOrig; k++){
+      Mem = Mem + CalcMemory(CorOrig[k]) + CalcMemory(Cor[k]);
+    }
+    Mem = Mem + CalcMemory(XvaOrig) + CalcMemory(SigOrig) + CalcMemory(UncOrig) +
+      CalcMemory(Xva) + CalcMemory(Sig) + CalcMemory(Unc);
+  }else if(IGrp == 1){
+    // The matrices of Solve() and the workspace
+    Mem = Mem + CalcMemory(Cov) + CalcMemory(CovL) + CalcMemory(CovI) + 
+      CalcMemory(CovS) + CalcMemory(CovW) + CalcMemory(CovT) + CalcMemory(Rho) + 
+      CalcMemory(Lam) + CalcMemory(CorRes) + CalcMemory(CovRes) + CalcMemory(RhoRes);
+    Mem = Mem + CalcMemory(CovD) + CalcMemory(Pul) + CalcMemory(XvaRes) +
+      CalcMemory(VarInd) + CalcMemory(IntWei) + CalcMemory(MarWei) + CalcMemory(BluWei);
+    for(Int_t w = 0; w<WrkNum; w++)Mem = Mem + CalcMemory(WrkMat[w]);
+    Mem = Mem + CalcMemory(WrkVec) + WrkNum * SizPtr + (InpUncOrig + InpEstOrig) * SizInt;
+    for(Int_t w = 0; w<SloMax*SloNum; w++)Mem = Mem + CalcMemory(SloMat[w]);
+    Mem = Mem + SloMax * (SloNum * SizPtr + (InpEstOrig + 1) * SizInt);
+  }else if(IGrp == 2){
+    for(Int_t n = 0; n<InpObsOrig; n++){
+      Mem = Mem + CalcMemory(ValSca[n]) + CalcMemory(SigSca[n]) + 
+	CalcMemory(VtoSca[n]) + CalcMemory(StoSca[n]);
+    }
+    Mem = Mem + CalcMemory(BasFac) + CalcMemory(BasFij) + 
+      CalcMemory(BasCovI) + CalcMemory(BasCovU) + 4*InpObsOrig * SizPtr;
+  }else if(IGrp == 3){
+    for(Int_t n = 0; n<InpObsOrig; n++){
+      Mem = Mem + CalcMemory(ValSen[n]) + CalcMemory(SigSen[n]);
+    }
+    Mem = Mem + 2*InpObsOrig * SizPtr;
+  }else if(IGrp == 4){
+    Mem = CalcMemory(LasImp) + CalcMemory(IndImp) + CalcMemory(ValImp) + 
+      CalcMemory(UncImp) + CalcMemory(StaImp) + CalcMemory(SysImp);
+  }else if(IGrp == 5){
+    Mem = CalcMemory(RhoMax) + CalcMemory(RhoMin) + CalcMemory(RhoOoz) + 
+      CalcMemory(RhoFij) + CalcMemory(VarMax) + CalcMemory(VarMin) + CalcMemory(RhoFpk);
+  }else if(IGrp == 6){
+    Mem = CalcMemory(SRat) + CalcMemory(Beta) + CalcMemory(Sigx) + 
+      CalcMemory(DBdr) + CalcMemory(DSdr) + CalcMemory(DBdz) + CalcMemory(DSdz);
+  }else if(IGrp == 7){
+    Mem = CalcMemory(ChiCov) + CalcMemory(ChiCovI) + CalcMemory(LikRes) + 
+      CalcMemory(ToyRes) + CalcMemory(ToyPul) + CalcMemory(ToyPro);
+  }
+  return Mem;
+};
+
+//------------------------------------------------------------------------------
+
+Long64_t Blue::CalcMemory(const TMatrixD *Mat) const {
+  // The object and, if they do not fit into the object, the elements
+  // TMatrixD keeps up to 25 elements in the object itself
+  const Int_t NumIns = 25;
+  if(Mat == NULL)return 0;
+  Long64_t Mem = sizeof(TMatrixD);
+  if(Mat->GetNoElements() > NumIns)Mem = Mem + Mat->GetNoElements() * sizeof(Double_t);
+  return Mem;
+};
+
+//------------------------------------------------------------------------------
+
+Long64_t Blue::CalcMemory(const TVectorD *Vec) const {
+  // As above for a vector, TVectorD keeps up to 5 elements in the object
+  const Int_t NumIns = 5;
+  if(Vec == NULL)return 0;
+  Long64_t Mem = sizeof(TVectorD);
+  if(Vec->GetNoElements() > NumIns)Mem = Mem + Vec->GetNoElements() * sizeof(Double_t);
+  return Mem;
+};
+
+//------------------------------------------------------------------------------
+
+Int_t Blue::CalcCholesky(const TMatrixD *InpMat, TMatrixD *OutLow) const {
+
+  // The return value 1 / 0 = positive definite / not positive definite
+  // On success OutLow holds the lower triangle L with InpMat = L * LT
+  Int_t NRows = InpMat->GetNrows();
+  Double_t Sum = 0;
+  OutLow->Zero();
+  for(Int_t j = 0; j<NRows; j++){
+    // The diagonal element, stop at the first non positive pivot
+    Sum = InpMat->operator()(j,j);
+    for(Int_t l = 0; l<j; l++){
+      Sum = Sum - OutLow->operator()(j,l) * OutLow->operator()(j,l);
+    }
+    // The negated test also catches a NaN pivot
+    //printf("... Blue->CalcCholesky(): Pivot %2i = %f \n", j, Sum);
+    if(!(Sum > 0))return 0;
+    OutLow->operator()(j,j) = TMath::Sqrt(Sum);
+
+    // The column below the diagonal
+    for(Int_t i = j+1; i<NRows; i++){
+      Sum = InpMat->operator()(i,j);
+      for(Int_t l = 0; l<j; l++){
+	Sum = Sum - OutLow->operator()(i,l) * OutLow->operator()(j,l);
+      }
+      OutLow->operator()(i,j) = Sum / OutLow->operator()(j,j);
+    }
+  }
+  //printf("... Blue->CalcCholesky(): L \n"); OutLow->Print();
+  return 1;
+};
+
+//------------------------------------------------------------------------------
+
+void Blue::CalcCholSolve(const TMatrixD *InpLow, TMatrixD *InOMat) const {
+
+  // Solve (L * LT) * X = B for all columns of B, X overwrites B
+  Int_t NRows = InpLow->GetNrows();
+  Int_t NCols = InOMat->GetNcols();
+  Double_t Sum = 0;
+  for(Int_t n = 0; n<NCols; n++){
+    // Forward substitution L * Y = B
+    for(Int_t i = 0; i<NRows; i++){
+      Sum = InOMat->operator()(i,n);
+      for(Int_t l = 0; l<i; l++){
+	Sum = Sum - InpLow->operator()(i,l) * InOMat->operator()(l,n);
+      }
+      InOMat->operator()(i,n) = Sum / InpLow->operator()(i,i);
+    }
+    // Backward substitution LT * X = Y
+    for(Int_t i = NRows-1; i>=0; i--){
+      Sum = InOMat->operator()(i,n);
+      for(Int_t l = i+1; l<NRows; l++){
+	Sum = Sum - InpLow->operator()(l,i) * InOMat->operator()(l,n);
+      }
+      InOMat->operator()(i,n) = Sum / InpLow->operator()(i,i);
+    }
+  }
+  return;
+};
+
+//------------------------------------------------------------------------------
+
+void Blue::CalcCholInvert(const TMatrixD *InpLow, TMatrixD *OutMat) const {
+
+  // Get (L * LT)-1 = (L-1)T * L-1, with L-1 again lower triangular. L-1 is
+  // kept in the lower half of OutMat, which is overwritten such that the
+  // elements still needed are never touched. OutMat must differ from InpLow.
+  Int_t NRows = InpLow->GetNrows();
+  Double_t Sum = 0;
+  for(Int_t j = 0; j<NRows; j++){
+    OutMat->operator()(j,j) = 1. / InpLow->operator()(j,j);
+    for(Int_t i = j+1; i<NRows; i++){
+      Sum = 0;
+      for(Int_t l = j; l<i; l++){
+	Sum = Sum - InpLow->operator()(i,l) * OutMat->operator()(l,j);
+      }
+      OutMat->operator()(i,j) = Sum / InpLow->operator()(i,i);
+    }
+  }
+
+  // Fill the symmetric result from the upper half
+  for(Int_t i = 0; i<NRows; i++){
+    for(Int_t j = i; j<NRows; j++){
+      Sum = 0;
+      for(Int_t l = j; l<NRows; l++){
+	Sum = Sum + OutMat->operator()(l,i) * OutMat->operator()(l,j);
       }
+      OutMat->operator()(i,j) = Sum;
+      OutMat->operator()(j,i) = Sum;
     }
   }
-  SetCalcedParams(1);
   return;
 };
 
 //------------------------------------------------------------------------------
 
+void Blue::CalcCovSolve(TMatrixD *InOMat) const {
+
+  // Solve Cov * X = B for all columns of B, X overwrites B
+  // Only for a positive definite covariance, see FillCovInvert()
+  if(IsLowRankCov() == 0){
+    CalcCholSolve(CovL, InOMat);
+    return;
+  }
+
+  // X = D-1 * B - D-1 * S * (1 + ST * D-1 * S)-1 * ST * D-1 * B
+  // column by column, such that the workspace CovT is one column
+  Int_t NRows = InOMat->GetNrows();
+  Int_t NCols = InOMat->GetNcols();
+  Int_t NRank = CovS->GetNcols();
+  TMatrixD *T = CovT;
+  Double_t Sum = 0;
+  for(Int_t n = 0; n<NCols; n++){
+    for(Int_t i = 0; i<NRows; i++){
+      InOMat->operator()(i,n) = InOMat->operator()(i,n) / CovD->operator()(i);
+    }
+    for(Int_t r = 0; r<NRank; r++){
+      Sum = 0;
+      for(Int_t i = 0; i<NRows; i++){
+	Sum = Sum + CovS->operator()(i,r) * InOMat->operator()(i,n);
+      }
+      T->operator()(r,0) = Sum;
+    }
+    CalcCholSolve(CovW, T);
+    for(Int_t i = 0; i<NRows; i++){
+      Sum = 0;
+      for(Int_t r = 0; r<NRank; r++){
+	Sum = Sum + CovS->operator()(i,r) * T->operator()(r,0);
+      }
+      InOMat->operator()(i,n) = InOMat->operator()(i,n) - Sum / CovD->operator()(i);
+    }
+  }
+  T = NULL;
+  return;
+};
+
+//------------------------------------------------------------------------------
+
+Int_t Blue::CalcAccImp(const Int_t n, const Int_t ActPre, const Int_t NumEst){
+
+  // The return value 1 / 0 = success / failure, use FixInp() and Solve()
+  // Fill (Val,Unc,Sta,Sys)Imp(i,n) for i = 1,..., NumEst-1, when adding the 
+  // estimates LisImp[i] of observable n to the ones of all other observables.
+  // The inverse of the active part of Cov is extended for each estimate via
+  //   (C   b)-1   (C-1 + v*vT/s   -v/s)
+  //   (bT  c)   = (-vT/s           1/s), v = C-1*b, s = c - bT*v
+  // which costs O(N^2) per estimate. With the row u of U of the new estimate
+  // and w = u - UT*v this is a rank-1 update of the rest
+  //   H = C-1*U -> (H - v*wT/s, wT/s),  F = UT*C-1*U -> F + w*wT/s
+  // such that F-1 is only inverted once, for the first solve, and then
+  // follows from Sherman-Morrison, F-1 -> F-1 - g*gT/(s + wT*g), g = F-1*w.
+  // The value and variance are CovRes = F-1 and column n of Lam = H*F-1.
+  FillZero(&WrkMat[26], InpEst, InpEst);
+  FillZero(&WrkMat[27], InpEst, InpObs);
+  FillZero(&WrkMat[28], InpObs, InpObs);
+  FillZero(&WrkMat[29], InpEst, 1);
+  FillZero(&WrkMat[40], 2, InpObs);
+  TMatrixD *CI = WrkMat[26];
+  TMatrixD *H = WrkMat[27];
+  TMatrixD *F = WrkMat[28];
+  TMatrixD *V = WrkMat[29];
+  TMatrixD *W = WrkMat[40];
+  Int_t *ActEst = &WrkInt[InpUncOrig];
+  Int_t NumAct = 0, IRet = 1, IAdd = -1, ia = -1, ja = -1;
+  Double_t Sum = 0, Sca = 0, Val = 0, Var = 0, Sta = 0;
+
+  // Loop over the estimates of the other observables, the most precise one,
+  // and then the ones in the list of importance
+  for(Int_t l = -InpEst; l<NumEst; l++){
+    if(l < 0){
+      IAdd = l + InpEst;
+      if(EstWhichObs(IsWhichEst(IAdd)) == IsWhichObs(n))continue;
+    }else if(l == 0){
+      IAdd = ActPre;
+    }else{
+      IAdd = IsIndexEst(LisImp[l]);
+    }
+
+    // Border the inverse with the new estimate
+    Sca = Cov->operator()(IAdd,IAdd);
+    for(Int_t a = 0; a<NumAct; a++){
+      Sum = 0;
+      for(Int_t b = 0; b<NumAct; b++){
+	Sum = Sum + CI->operator()(a,b) * Cov->operator()(ActEst[b],IAdd);
+      }
+      V->operator()(a,0) = Sum;
+      Sca = Sca - Cov->operator()(ActEst[a],IAdd) * Sum;
+    }
+    // The negated test also catches a NaN Schur complement
+    //printf("... Blue->CalcAccImp(): Not positive definite %2i %f \n", IAdd, Sca);
+    if(!(Sca > 0)){
+      IRet = 0;
+      break;
+    }
+
+    // The first row of W is w = u - UT*v, with v = C-1*b of the old set
+    for(Int_t m = 0; m<InpObs; m++){
+      Sum = Uma->operator()(IAdd,m);
+      for(Int_t a = 0; a<NumAct; a++){
+	Sum = Sum - Uma->operator()(ActEst[a],m) * V->operator()(a,0);
+      }
+      W->operator()(0,m) = Sum;
+    }
+    for(Int_t m = 0; m<InpObs; m++){
+      for(Int_t a = 0; a<NumAct; a++){
+	H->operator()(a,m) = H->operator()(a,m) - V->operator()(a,0) * W->operator()(0,m) / Sca;
+      }
+      H->operator()(NumAct,m) = W->operator()(0,m) / Sca;
+    }
+    for(Int_t a = 0; a<NumAct; a++){
+      for(Int_t b = 0; b<NumAct; b++){
+	CI->operator()(a,b) = CI->operator()(a,b) + V->operator()(a,0) * V->operator()(b,0) / Sca;
+      }
+      CI->operator()(a,NumAct) = -V->operator()(a,0) / Sca;
+      CI->operator()(NumAct,a) = CI->operator()(a,NumAct);
+    }
+    CI->operator()(NumAct,NumAct) = 1. / Sca;
+    ActEst[NumAct] = IAdd;
+    NumAct = NumAct + 1;
+
+    // Until the first solve F itself is updated, and then inverted once.
+    // Afterwards F holds F-1, the second row of W is g = F-1*w
+    if(l <= 1){
+      for(Int_t m = 0; m<InpObs; m++){
+	for(Int_t o = 0; o<InpObs; o++){
+	  F->operator()(m,o) = F->operator()(m,o) + W->operator()(0,m) * W->operator()(0,o) / Sca;
+	}
+      }
+      if(l < 1)continue;
+      F->Invert();
+    }else{
+      Var = Sca;
+      for(Int_t m = 0; m<InpObs; m++){
+	Sum = 0;
+	for(Int_t o = 0; o<InpObs; o++){
+	  Sum = Sum + F->operator()(m,o) * W->operator()(0,o);
+	}
+	W->operator()(1,m) = Sum;
+	Var = Var + W->operator()(0,m) * Sum;
+      }
+      for(Int_t m = 0; m<InpObs; m++){
+	for(Int_t o = 0; o<InpObs; o++){
+	  F->operator()(m,o) = F->operator()(m,o) - W->operator()(1,m) * W->operator()(1,o) / Var;
+	}
+      }
+    }
+
+    // Column n of Lam, the value, its variance and the first source
+    for(Int_t a = 0; a<NumAct; a++){
+      Sum = 0;
+      for(Int_t m = 0; m<InpObs; m++){
+	Sum = Sum + H->operator()(a,m) * F->operator()(m,n);
+      }
+      V->operator()(a,0) = Sum;
+    }
+    Val = 0;
+    Sta = 0;
+    for(Int_t a = 0; a<NumAct; a++){
+      ia = ActEst[a];
+      Val = Val + V->operator()(a,0) * Xva->operator()(ia);
+      for(Int_t b = 0; b<NumAct; b++){
+	ja = ActEst[b];
+	Sta = Sta + V->operator()(a,0) * Unc->operator()(ia+0*InpEst) * Cor[0]->operator()(ia,ja) * 
+	  Unc->operator()(ja+0*InpEst) * V->operator()(b,0);
+      }
+    }
+    Var = F->operator()(n,n);
+    ValImp->operator()(l,n) = Val;
+    UncImp->operator()(l,n) = TMath::Sqrt(Var);
+    StaImp->operator()(l,n) = TMath::Sqrt(Sta);
+    SysImp->operator()(l,n) = TMath::Sqrt(UncImp->operator()(l,n)*UncImp->operator()(l,n)-
+					  StaImp->operator()(l,n)*StaImp->operator()(l,n));
+  }
+
+  // Clean up
+  CI = NULL;
+  H = NULL;
+  F = NULL;
+  V = NULL;
+  W = NULL;
+  ActEst = NULL;
+  return IRet;
+};
+
+//------------------------------------------------------------------------------
+
+Double_t Blue::CalcScaCor(const Int_t k, const Int_t i, const Int_t j, 
+			  const TMatrixD *UseFac, const TMatrixD *UseFij) const {
+
+  // The correlation of the active estimates i and j for the active source k
+  // as in FixInp(). For i != j the original one is scaled by the factor of
+  // the group of i and j and, for UseFij != NULL and all but the first 
+  // source, futched by UseFij
+  Int_t kk = IsWhichUnc(k);
+  Int_t ii = IsWhichEst(i);
+  Int_t jj = IsWhichEst(j);
+  Double_t Rhoij = CorOrig[kk]->operator()(ii,jj);
+  if(i == j)return Rhoij;
+  if(IsRhoFacUnc(kk) == 1){
+    Rhoij = Rhoij * UseFac->operator()(kk,static_cast<int>(MatFac->operator()(ii,jj)));
+  }
+  if(UseFij != NULL && kk > 0)Rhoij = Rhoij * UseFij->operator()(ii,jj);
+  return Rhoij;
+};
+
+//------------------------------------------------------------------------------
+
+void Blue::CalcScaCov(const TMatrixD *UseFac, const TMatrixD *UseFij, TMatrixD *OutCov) const {
+
+  // The covariance as in FixInp(), Cov = sum E*C*E with the scaled C
+  OutCov->Zero();
+  for(Int_t k = 0; k<InpUnc; k++){
+    for(Int_t i = 0; i<InpEst; i++){
+      for(Int_t j = i; j<InpEst; j++){
+	OutCov->operator()(i,j) = OutCov->operator()(i,j) + 
+	  Unc->operator()(i+k*InpEst) * CalcScaCor(k, i, j, UseFac, UseFij) * Unc->operator()(j+k*InpEst);
+	OutCov->operator()(j,i) = OutCov->operator()(i,j);
+      }
+    }
+  }
+  return;
+};
+
+//------------------------------------------------------------------------------
+
+Int_t Blue::CalcScaCha(const TMatrixD *UseFac, const TMatrixD *UseFij, Int_t *LisCha) const {
+
+  // The return value is the number r of active estimates for which a
+  // correlation differs from the base of FillScaBase(), LisCha lists them
+  const TMatrixD *BasUse = NULL;
+  if(ScaFut == 1)BasUse = BasFij;
+
+  // Check whether any futch factor changed
+  Int_t IFut = 0;
+  Double_t FijUse = 1, FijBas = 1;
+  if(UseFij != NULL || BasUse != NULL){
+    for(Int_t i = 0; i<InpEst; i++){
+      for(Int_t j = i+1; j<InpEst; j++){
+	FijUse = 1;
+	FijBas = 1;
+	if(UseFij != NULL)FijUse = UseFij->operator()(IsWhichEst(i),IsWhichEst(j));
+	if(BasUse != NULL)FijBas = BasUse->operator()(IsWhichEst(i),IsWhichEst(j));
+	if(FijUse != FijBas)IFut = 1;
+      }
+    }
+  }
+
+  // Only look at the sources with changed factors
+  Int_t IAdd = 0, NumCha = 0;
+  for(Int_t i = 0; i<InpEst; i++)LisCha[i] = 0;
+  for(Int_t k = 0; k<InpUnc; k++){
+    IAdd = 0;
+    for(Int_t l = 0; l<InpFac; l++){
+      if(UseFac->operator()(IsWhichUnc(k),l) != BasFac->operator()(IsWhichUnc(k),l))IAdd = 1;
+    }
+    if(IFut == 1 && IsWhichUnc(k) > 0)IAdd = 1;
+    if(IAdd == 1){
+      for(Int_t i = 0; i<InpEst; i++){
+	for(Int_t j = i+1; j<InpEst; j++){
+	  if(Unc->operator()(i+k*InpEst) * Unc->operator()(j+k*InpEst) != 0 &&
+	     CalcScaCor(k, i, j, UseFac, UseFij) != CalcScaCor(k, i, j, BasFac, BasUse)){
+	    LisCha[i] = 1;
+	    LisCha[j] = 1;
+	  }
+	}
+      }
+    }
+  }
+  for(Int_t i = 0; i<InpEst; i++){
+    if(LisCha[i] == 1){
+      LisCha[NumCha] = i;
+      NumCha = NumCha + 1;
+    }
+  }
+  return NumCha;
+};
+
+//------------------------------------------------------------------------------
+
+Int_t Blue::CalcScaCap(const TMatrixD *UseFac, const TMatrixD *UseFij, const Int_t NumCha, 
+		       const Int_t *LisCha, TMatrixD *D, TMatrixD *S) const {
+
+  // The return value 1 / 0 = stable / unstable low rank update
+  // For Cov = Cov0 + P * D * PT, with P selecting the r = NumCha estimates
+  // LisCha, fill D and the inverse of the capacitance S = 1 + PT*Cov0-1*P*D
+  const TMatrixD *BasUse = NULL;
+  if(ScaFut == 1)BasUse = BasFij;
+  Double_t Dif = 0, Sum = 0;
+  D->Zero();
+  for(Int_t a = 0; a<NumCha; a++){
+    for(Int_t b = 0; b<NumCha; b++){
+      if(a != b){
+	Dif = 0;
+	for(Int_t k = 0; k<InpUnc; k++){
+	  Dif = Dif + Unc->operator()(LisCha[a]+k*InpEst) * 
+	    (CalcScaCor(k, LisCha[a], LisCha[b], UseFac, UseFij) - 
+	     CalcScaCor(k, LisCha[a], LisCha[b], BasFac, BasUse)) *
+	    Unc->operator()(LisCha[b]+k*InpEst);
+	}
+	D->operator()(a,b) = Dif;
+      }
+    }
+  }
+  for(Int_t a = 0; a<NumCha; a++){
+    for(Int_t b = 0; b<NumCha; b++){
+      Sum = 0;
+      for(Int_t c = 0; c<NumCha; c++){
+	Sum = Sum + BasCovI->operator()(LisCha[a],LisCha[c]) * D->operator()(c,b);
+      }
+      if(a == b)Sum = Sum + 1;
+      S->operator()(a,b) = Sum;
+    }
+  }
+
+  // Give up for an ill conditioned S
+  Double_t Cnd = S->Norm1();
+  S->Invert();
+  Cnd = Cnd * S->Norm1();
+  //printf("... Blue->CalcScaCap(): Condition %e \n", Cnd);
+  if(Cnd < 1.E10)return 1;
+  return 0;
+};
+
+//------------------------------------------------------------------------------
+
+void Blue::CalcScaPre(TVectorD *SigPre) const {
+
+  // The uncertainty of the most precise estimate per observable if it has
+  // more than one, otherwise -1. This does not depend on the correlations.
+  Int_t CouEst = 0;
+  for(Int_t n = 0; n<InpObs; n++){
+    SigPre->operator()(n) = -1;
+    CouEst = 0;
+    for(Int_t i = 0; i<InpEst; i++){
+      if(EstWhichObs(IsWhichEst(i)) == IsWhichObs(n))CouEst = CouEst + 1;
+    }
+    if(CouEst > 1){
+      for(Int_t i = 0; i<InpEst; i++){
+	if(IsWhichEst(i) == GetPreEst(IsWhichObs(n)))SigPre->operator()(n) = Sig->operator()(i);
+      }
+    }
+  }
+  return;
+};
+
+//------------------------------------------------------------------------------
+
+Int_t Blue::CalcScaRho(const TMatrixD *UseFac, const TMatrixD *UseFij, const TVectorD *SigPre, 
+		       const Int_t p, const Int_t q, TMatrixD *RetVal, TMatrixD *RetVar, Int_t *IWoo) const {
+
+  // The return value 1 / <0 = success / failure, the code as for InspectResult()
+  // Combine the fixed input with the original correlations of all active
+  // sources scaled by UseFac and futched by UseFij, see CalcScaCor(). The
+  // result of observable n goes to (p,n) of RetVal and RetVar. This only
+  // writes to the workspace of slot q, see FillSloWrk(), such that it can be
+  // called for many points at the same time, one slot per thread, see
+  // SolveScaRho().
+  // IWoo[p] = 1 / 0 / -1 = low rank update / full solution / full solution
+  // since the low rank update was unstable
+  TMatrixD **Slo = &SloMat[q*SloNum];
+  FillZero(&Slo[0], InpEst, InpObs, &SloAll[q]);
+  FillZero(&Slo[1], InpObs, InpObs, &SloAll[q]);
+  FillZero(&Slo[2], InpObs, InpObs, &SloAll[q]);
+  FillZero(&Slo[3], InpEst, InpObs, &SloAll[q]);
+  TMatrixD *H = Slo[0];
+  TMatrixD *F = Slo[1];
+  TMatrixD *G = Slo[2];
+  TMatrixD *W = Slo[3];
+
+  // With the base of FillScaBase() find the r estimates with changed
+  // correlations. For Cov = Cov0 + P * D * PT, with P selecting them, use
+  //   (Cov0 + P*D*PT)-1 = Cov0-1 - Cov0-1*P*D*(1 + PT*Cov0-1*P*D)-1*PT*Cov0-1
+  // which costs O(N^2*r) instead of O(N^3). Only done if it pays off.
+  IWoo[p] = 0;
+  Int_t NumCha = 0;
+  Int_t *LisCha = &SloInt[q*InpEstOrig];
+  Double_t Sum = 0;
+  if(IsLowRankScan() == 1 && ScaBas == 1){
+    NumCha = CalcScaCha(UseFac, UseFij, LisCha);
+    if(2*NumCha <= InpEst)IWoo[p] = 1;
+  }
+  if(IWoo[p] == 1 && NumCha == 0){
+    H->operator=(*BasCovU);
+  }else if(IWoo[p] == 1){
+    FillZero(&Slo[4], NumCha, NumCha, &SloAll[q]);
+    FillZero(&Slo[5], NumCha, NumCha, &SloAll[q]);
+    FillZero(&Slo[6], NumCha, InpObs, &SloAll[q]);
+    FillZero(&Slo[7], NumCha, InpObs, &SloAll[q]);
+    TMatrixD *D = Slo[4];
+    TMatrixD *S = Slo[5];
+    TMatrixD *T = Slo[6];
+    TMatrixD *Y = Slo[7];
+    if(CalcScaCap(UseFac, UseFij, NumCha, LisCha, D, S) == 1){
+      // T = S-1 * PT*Cov0-1*U, Y = D * T, H = Cov0-1*U - Cov0-1*P * Y
+      for(Int_t a = 0; a<NumCha; a++){
+	for(Int_t n = 0; n<InpObs; n++){
+	  Sum = 0;
+	  for(Int_t b = 0; b<NumCha; b++){
+	    Sum = Sum + S->operator()(a,b) * BasCovU->operator()(LisCha[b],n);
+	  }
+	  T->operator()(a,n) = Sum;
+	}
+      }
+      Y->Mult(*D, *T);
+      for(Int_t i = 0; i<InpEst; i++){
+	for(Int_t n = 0; n<InpObs; n++){
+	  Sum = 0;
+	  for(Int_t a = 0; a<NumCha; a++){
+	    Sum = Sum + BasCovI->operator()(i,LisCha[a]) * Y->operator()(a,n);
+	  }
+	  H->operator()(i,n) = BasCovU->operator()(i,n) - Sum;
+	}
+      }
+    }else{
+      //printf("... Blue->CalcScaRho(): Unstable low rank update %2i \n", p);
+      IWoo[p] = -1;
+    }
+    D = NULL;
+    S = NULL;
+    T = NULL;
+    Y = NULL;
+  }
+  LisCha = NULL;
+
+  // The weights as in Solve(), W = Lam = H * F-1, with H = Cov-1 * U and
+  // F = UT * Cov-1 * U, via Cholesky factors if possible. A low rank update
+  // that does not give a positive definite F is also solved in full.
+  if(IWoo[p] == 1){
+    F->Mult(*Utr,*H);
+    if(CalcCholesky(F, G) == 1){
+      CalcCholInvert(G, F);
+    }else{
+      IWoo[p] = -1;
+    }
+  }
+  if(IWoo[p] != 1){
+    FillZero(&Slo[8], InpEst, InpEst, &SloAll[q]);
+    FillZero(&Slo[9], InpEst, InpEst, &SloAll[q]);
+    TMatrixD *C = Slo[8];
+    TMatrixD *L = Slo[9];
+    CalcScaCov(UseFac, UseFij, C);
+    H->operator=(*Uma);
+    if(CalcCholesky(C, L) == 1){
+      CalcCholSolve(L, H);
+      F->Mult(*Utr,*H);
+      if(CalcCholesky(F, G) == 1){
+	CalcCholInvert(G, F);
+      }else{
+	F->Invert();
+      }
+    }else{
+      C->Invert();
+      H->Mult(*C, *Uma);
+      F->Mult(*Utr,*H);
+      F->Invert();
+    }
+    C = NULL;
+    L = NULL;
+  }
+  W->Mult(*H, *F);
+
+  // Check for negative or -nan total variances and for a larger uncertainty
+  // than the most precise estimate, SigPre(n) < 0 if there is only one
+  Int_t CovNeg = 0, CovLar = 0;
+  Double_t Val = 0;
+  for(Int_t n = 0; n<InpObs; n++){
+    if(F->operator()(n,n) < 0 || TMath::IsNaN(F->operator()(n,n)) == 1)CovNeg = 1;
+    if(SigPre->operator()(n) >= 0){
+      if(TMath::Sqrt(F->operator()(n,n)) > SigPre->operator()(n))CovLar = 1;
+    }
+    Val = 0;
+    for(Int_t i = 0; i<InpEst; i++){
+      Val = Val + W->operator()(i,n)*Xva->operator()(i);
+    }
+    RetVal->operator()(p,n) = Val;
+    RetVar->operator()(p,n) = F->operator()(n,n);
+  }
+
+  // Check for negative or -nan variances per source
+  // Cov(n,n)_k = Lam(i,n)*Cov(i,j)_k*Lam(j,n)
+  // Un-correlated sources cannot be negative, and only non zero
+  // uncertainties contribute
+  Int_t CorNeg = 0;
+  Double_t Wcw = 0;
+  for(Int_t k = 0; k<InpUnc; k++){
+    if(CorTypOrig[IsWhichUnc(k)] != 0){
+      for(Int_t n = 0; n<InpObs; n++){
+	Sum = 0;
+	for(Int_t i = 0; i<InpEst; i++){
+	  if(Unc->operator()(i+k*InpEst) != 0){
+	    Wcw = 0;
+	    for(Int_t j = 0; j<InpEst; j++){
+	      Wcw = Wcw + CalcScaCor(k, i, j, UseFac, UseFij) * Unc->operator()(j+k*InpEst) * W->operator()(j,n);
+	    }
+	    Sum = Sum + W->operator()(i,n) * Unc->operator()(i+k*InpEst) * Wcw;
+	  }
+	}
+	if(Sum < 0 || TMath::IsNaN(Sum) == 1)CorNeg = 1;
+      }
+    }
+  }
+  H = NULL;
+  F = NULL;
+  G = NULL;
+  W = NULL;
+  Slo = NULL;
+
+  if(CovNeg == 1 || CorNeg == 1 || CovLar == 1){
+    return -1*(100*CovLar + 10*CovNeg + CorNeg);
+  }
+  return 1;
+};
+
+//------------------------------------------------------------------------------
+
+Double_t Blue::CalcMaxVar(const Int_t n, const Int_t k, const Int_t l, const Double_t RhoFac,
+			  const Int_t IScan, const TVectorD *SigPre){
+
+  // The return value is the variance of the active observable n, see
+  // SolveMaxVar(), with the correlations
+  // IFuFla = 0: of all sources but the first scaled by RhoFac
+  // IFuFla = 1: of source k scaled by RhoFac
+  // IFuFla = 2: of the estimates k and l futched by RhoFac
+  // For a failed combination it is -1.
+  if(IsFixedInp() == 1)ReleaseInp();
+  if(IFuFla == 0){
+    for(Int_t kk = 1; kk<InpUncOrig; kk++){if(IsActiveUnc(kk))SetRhoFacUnc(kk,RhoFac);};
+  }else if(IFuFla == 1){
+    SetRhoFacUnc(k,RhoFac);
+  }else{
+    SetFutchCor(k,l,1,RhoFac);
+  }
+  const TMatrixD *UseFij = NULL;
+  if(IFuFla == 2)UseFij = RhoFij;
+
+  // Combine via CalcScaRho() or in full
+  Int_t IRes = 0, IWoo = 0;
+  Double_t VarAct = 0;
+  if(IScan == 1){
+    FillZero(&WrkMat[34], 1, InpObs);
+    FillZero(&WrkMat[35], 1, InpObs);
+    TMatrixD *ValMat = WrkMat[34];
+    TMatrixD *VarMat = WrkMat[35];
+    IRes = CalcScaRho(ActFac, UseFij, SigPre, 0, 0, ValMat, VarMat, &IWoo);
+    VarAct = VarMat->operator()(0,n);
+    ValMat = NULL;
+    VarMat = NULL;
+  }else{
+    FixInp();
+    Solve();
+    IRes = InspectResult();
+    VarAct = CovRes->operator()(n,n);
+  }
+  if(IRes < 0){
+    IFuFai[IFuFla] = IFuFai[IFuFla] + 1;	  
+    if(IsPrintLevel() > 2 && IFuFla == 2){
+      printf("... Blue->SolveMaxVar(%2i): Strange Covariance %2i %2i %2i %5.3f %12.9f \n",
+	     IFuFla,k,l,IRes,RhoFac,VarAct);
+    }else if(IsPrintLevel() > 2){
+      printf("... Blue->SolveMaxVar(%2i): Strange Covariance %2i %2i %5.3f %12.9f \n",
+	     IFuFla,k,IRes,RhoFac,VarAct);
+    }
+    return -1;
+  }
+  return VarAct;
+};
+
+//------------------------------------------------------------------------------
+
+Double_t Blue::CalcMaxFac(const Int_t n, const Int_t k, const Int_t l, const Double_t RhoIni, 
+			  Double_t *VarRun, const Int_t IScan, const TVectorD *SigPre){
+
+  // The return value is the factor in [0,1] for k and l, see CalcMaxVar(),
+  // that maximises the variance of the active observable n. It only replaces
+  // RhoIni if the variance is larger than VarRun, which is then updated.
+  // 1) A coarse scan in steps of 0.1 brackets the maximum
+  // 2) Brent's method, i.e. parabolic steps with golden section steps as
+  //    fall back, refines it within this bracket to a precision TolMax
+  Int_t    NumCoa = 10;
+  Double_t RhoCoa = 0.1, RhoLim = 0;
+  Double_t RhoBes = 1, VarBes = *VarRun;
+  Double_t RhoFac = 1, VarAct = 0;
+  for(Int_t m = 1; m<=NumCoa; m++){
+    RhoFac = 1 - m*RhoCoa;
+    VarAct = CalcMaxVar(n, k, l, RhoFac, IScan, SigPre);
+    if(VarAct > VarBes){
+      VarBes = VarAct;
+      RhoBes = RhoFac;
+    }
+  }
+  //printf("... Blue->CalcMaxFac(%2i): Coarse %5.3f %12.9f \n", k, RhoBes, VarBes);
+
+  // Minimise -Var in (a,b) starting from the best coarse value x
+  const Double_t CGold = 0.3819660;
+  Double_t a = TMath::Max(RhoBes - RhoCoa, RhoLim);
+  Double_t b = TMath::Min(RhoBes + RhoCoa, 1.);
+  Double_t x = RhoBes, w = RhoBes, v = RhoBes, u = 0;
+  Double_t fx = -VarBes, fw = fx, fv = fx, fu = 0;
+  Double_t d = 0, e = 0, xm = 0, Tol1 = TolMax, Tol2 = 2*TolMax;
+  Double_t p = 0, q = 0, r = 0, Etemp = 0;
+  for(Int_t Ite = 0; Ite<100; Ite++){
+    xm = 0.5*(a+b);
+    if(TMath::Abs(x-xm) <= Tol2 - 0.5*(b-a))break;
+    if(TMath::Abs(e) > Tol1){
+      // Try a parabolic step through x, w and v
+      r = (x-w)*(fx-fv);
+      q = (x-v)*(fx-fw);
+      p = (x-v)*q - (x-w)*r;
+      q = 2*(q-r);
+      if(q > 0)p = -p;
+      q = TMath::Abs(q);
+      Etemp = e;
+      e = d;
+      if(TMath::Abs(p) >= TMath::Abs(0.5*q*Etemp) || p <= q*(a-x) || p >= q*(b-x)){
+	if(x >= xm){e = a-x;}else{e = b-x;};
+	d = CGold*e;
+      }else{
+	d = p/q;
+	u = x+d;
+	if(u-a < Tol2 || b-u < Tol2){
+	  if(xm >= x){d = Tol1;}else{d = -Tol1;};
+	}
+      }
+    }else{
+      // A golden section step into the larger part
+      if(x >= xm){e = a-x;}else{e = b-x;};
+      d = CGold*e;
+    }
+    if(TMath::Abs(d) >= Tol1){
+      u = x+d;
+    }else if(d >= 0){
+      u = x+Tol1;
+    }else{
+      u = x-Tol1;
+    }
+    fu = -CalcMaxVar(n, k, l, u, IScan, SigPre);
+    //printf("... Blue->CalcMaxFac(%2i): %2i %8.6f %12.9f \n", k, Ite, u, -fu);
+    if(fu <= fx){
+      if(u >= x){a = x;}else{b = x;};
+      v = w; fv = fw;
+      w = x; fw = fx;
+      x = u; fx = fu;
+    }else{
+      if(u < x){a = u;}else{b = u;};
+      if(fu <= fw || w == x){
+	v = w; fv = fw;
+	w = u; fw = fu;
+      }else if(fu <= fv || v == x || v == w){
+	v = u; fv = fu;
+      }
+    }
+  }
+  RhoBes = x;
+  VarBes = -fx;
+
+  // Only take it if better
+  if(VarBes > *VarRun){
+    *VarRun = VarBes;
+    return RhoBes;
+  }
+  return RhoIni;
+};
+
+//------------------------------------------------------------------------------
+
 void Blue::ResetScaRho(const Int_t IFlag){
 
   // Set the actual factors to unity
   if(IFlag == 0 || IFlag == 2){ 
     for(Int_t k = 0; k<InpUncOrig; k++){
       for(Int_t l = 0; l<InpFac; l++){
+	if(ActFac->operator()(k,l) != 1)UncDir[k] = 1;
 	ActFac->operator()(k,l) = 1;
       }
     }
@@ -8096,43 +11200,25 @@ Int_t Blue::IsWhichMatrix(const TMatrixD *TryMat) const {
     return 3;
   }
 
-  //
-  // Try to see what matrix it is
-  //
-  TMatrixD* NCor = new TMatrixD(NRows,NRows);
-  TMatrixD* FCor = new TMatrixD(NRows,NRows);
-  TMatrixD* Null = new TMatrixD(NRows,NRows);
-  TMatrixD* Comp = new TMatrixD(NRows,NRows);
-  NCor->UnitMatrix();
-  for(Int_t i = 0; i < NRows; i++){
-    for(Int_t j = 0; j < NRows; j++){
-      FCor->operator()(i,j) = 1;
-      Null->operator()(i,j) = 0;
-    }
-  }
-  //printf("... Blue->IsWhichMatrix(): NCor \n"); NCor->Print();
-  //printf("... Blue->IsWhichMatrix(): FCor \n"); FCor->Print();
-  //printf("... Blue->IsWhichMatrix(): Null \n"); Null->Print();
-
   // The testing flags
   Int_t ITest = 0;
   Double_t Small = 0.000000001;
 
-  // Test for Un-correlated or Fully-correlated
-  for(Int_t io = 0; io < 2; io++){    
-    ITest = 0;
-    Comp->operator=(*Null);
-    if(io == 0){Comp->operator+=(*NCor);
-    }else{Comp->operator+=(*FCor);};
-    Comp->operator-=(*TryMat);
-    //printf("... Blue->IsWhichMatrix(): Comp \n"); Comp->Print();
-    for(Int_t i = 0; i < NRows; i++){
-      for(Int_t j = i; j < NRows; j++){
-	if(Comp->operator()(j,i) != 0)ITest = 1;
-      }     
+  // Test for Un-correlated or Fully-correlated, compare the lower
+  // triangle in place against the unit matrix and the matrix of ones
+  Int_t IUnc = 0, IFul = 0;
+  for(Int_t i = 0; i < NRows; i++){
+    for(Int_t j = i; j < NRows; j++){
+      if(j == i){
+	if(TryMat->operator()(j,i) != 1)IUnc = 1;
+      }else{
+	if(TryMat->operator()(j,i) != 0)IUnc = 1;
+      }
+      if(TryMat->operator()(j,i) != 1)IFul = 1;
     }
-    if(ITest == 0)IsWhichM = io;    
   }
+  if(IUnc == 0)IsWhichM = 0;
+  if(IFul == 0)IsWhichM = 1;
 
   // Test for symmetric if the above failed
   ITest = 0;
@@ -8151,12 +11237,6 @@ Int_t Blue::IsWhichMatrix(const TMatrixD *TryMat) const {
     if(ITest == 0)IsWhichM = 2;
   }
 
-  // Clean up
-  NCor->Delete(); NCor = NULL;
-  FCor->Delete(); FCor = NULL;
-  Null->Delete(); Null = NULL;
-  Comp->Delete(); Comp = NULL;
-
   // We are done
   return IsWhichM;
 };
@@ -8239,7 +11319,7 @@ void Blue::WriteInput(const Int_t IWhat, const TString FilNam,
       IRet = sprintf(c,Format,Sig->operator()(i)); ofs<<c;
     }else{
       for(Int_t k = 0; k < InpUnc; k++){
-	IRet = sprintf(c,Format,Unc->operator()(i+k*InpEst,i+k*InpEst)); ofs<<c;
+	IRet = sprintf(c,Format,Unc->operator()(i+k*InpEst)); ofs<<c;
       }
     }
     IRet = sprintf(c,"\n"); ofs<<c;
@@ -8258,26 +11338,15 @@ void Blue::WriteInput(const Int_t IWhat, const TString FilNam,
     }
   }else{
     for(Int_t k = 0; k < InpUnc; k++){
-      // Get the matrix per source
-      TMatrixD *F = new TMatrixD(InpEst,InpEst);
-      Int_t IRowLow = k*InpEst; 
-      Int_t IRowHig = IRowLow + InpEst-1;
-      Int_t IColLow = IRowLow; 
-      Int_t IColHig = IRowHig;
-      //  printf("... %3i, %3i, %3i, %3i \n",IRowLow, IColLow, IRowHig, IColHig);
-      Cor->GetSub(IRowLow, IRowHig, IColLow, IColHig, *F, "S");
-
-      // Write the findings
+      // Write the matrix per source
       for(Int_t i = 0; i < InpEst; i++){
 	for(Int_t j = 0; j < InpEst; j++){
-	  IRet = sprintf(c,Format,F->operator()(i,j)); ofs<<c;
+	  IRet = sprintf(c,Format,Cor[k]->operator()(i,j)); ofs<<c;
 	}
 	if(i == 0){IRet = sprintf(c," '%s'",UncNam[IsWhichUnc(k)].Data()); ofs<<c;};
 	IRet = sprintf(c,"\n"); ofs<<c;
       }
       IRet = sprintf(c,"\n"); ofs<<c;	
-      // clean up
-      F->Delete(); F = NULL;
     }
   }
   
@@ -8296,7 +11365,10 @@ void Blue::WriteInput(const Int_t IWhat, const TString FilNam,
 //----------------------------------------------------------------------------
 
 void Blue::PlotRes(const Int_t N, const TString FilNam, 
-		   const TString ForVal, const TString ForUnc) const {
+		   const TString ForVal, const TString ForUnc,
+		   const Int_t *Indx, const Int_t *Colo, const TString *Name,
+		   const Double_t *Valu, const Double_t *Stat, const Double_t *Syst,
+		   const Double_t *Full) const {
 
   // Declare variables
   char c[100];
@@ -8540,3 +11612,4 @@ void Blue::PlotRes(const Int_t N, const TString FilNam,
   // Close file
   ofs.close();
 };
+
@@ -21,6 +21,7 @@
 #include "TMatrixD.h"
 #include "TVectorD.h"
 #include "TDatime.h"
+#include <atomic>
  
 class Blue: public TObject {
 
@@ -64,6 +65,7 @@ public:
   void SolveInfWei();
   void SolvePosWei();
   void SolveMaxVar(const Int_t IFuRho);
+  void SolveSensitivity();
   
   //----------------------------------------------------------------------------
   // Filler
@@ -125,23 +127,45 @@ public:
   Int_t GetResult(Double_t *RetResult) const;
   Int_t GetUncert(TMatrixD *UseUncert) const;
   Int_t GetUncert(Double_t *RetUncert) const;
+  Int_t GetResultVar(const TMatrixD *InpVal, TMatrixD *UseResVal, 
+		     TMatrixD *UsePulVal, Double_t *RetChiVal) const;
 
   // For InspectLike
   Int_t GetInspectLike(TMatrixD *UseInsLik) const;
   Int_t GetInspectLike(Double_t *RetInsLik) const;
 
+  // For InspectToys
+  Int_t GetInspectToys(TMatrixD *UseInsToy) const;
+  Int_t GetToysPulHis(TMatrixD *UsePulHis) const;
+  Int_t GetToysProHis(TMatrixD *UseProHis) const;
+
   // After SolveXXX()
   Int_t GetAccImpLasEst(const Int_t n) const;
   Int_t GetAccImpIndEst(const Int_t n, Int_t *IndEst) const;
 
+  Int_t GetNumRelUnc() const;
+  Int_t GetRelUncHis(TMatrixD *UseRelHis) const;
+  Int_t GetRelUncHis(Double_t *RetRelHis) const;
+
   Int_t GetNumScaFac() const;
   Int_t GetNumScaRho() const;
+  Int_t GetNumThreads() const;
+  Int_t GetNumAlloc() const;
+  Long64_t GetMemory() const;
 
   Int_t GetScaVal(const Int_t n, TMatrixD *UseScaVal) const;
   Int_t GetScaVal(const Int_t n, Double_t *RetScaVal) const;
   Int_t GetScaUnc(const Int_t n, TMatrixD *UseScaUnc) const;
   Int_t GetScaUnc(const Int_t n, Double_t *RetScaUnc) const;
 
+  Int_t GetSenVal(const Int_t n, TMatrixD *UseSenVal) const;
+  Int_t GetSenVal(const Int_t n, Double_t *RetSenVal) const;
+  Int_t GetSenUnc(const Int_t n, TMatrixD *UseSenUnc) const;
+  Int_t GetSenUnc(const Int_t n, Double_t *RetSenUnc) const;
+
+  Int_t GetDerivative(const Int_t IWhat, const Int_t i, const Int_t k, TMatrixD *UseDer) const;
+  Int_t GetDerivative(const Int_t IWhat, const Int_t i, const Int_t k, Double_t *RetDer) const;
+
   //----------------------------------------------------------------------------
   // Setters
   //----------------------------------------------------------------------------
@@ -174,12 +198,23 @@ public:
   void SetNotRelUnc();
   void SetNotRelUnc(const Int_t k);
 
+  void SetNumThreads(const Int_t n);
+  void SetLowRankScan();
+  void SetNotLowRankScan();
+  void SetTolMaxVar(const Double_t Tol);
+
+  // Thread-safe mode for all instances, see SetThreadSafe()
+  static void  SetThreadSafe();
+  static void  SetNotThreadSafe();
+  static Int_t IsThreadSafe();
+
   //----------------------------------------------------------------------------
   // Control Printout
   //----------------------------------------------------------------------------
   void SetPrintLevel(const Int_t p);
   void SetQuiet();
   void SetNotQuiet();
+  Int_t IsQuiet() const;
 
   //----------------------------------------------------------------------------
   // Print Out
@@ -233,6 +268,7 @@ public:
   void PrintChiPro() const;
 
   void PrintInspectLike() const;
+  void PrintInspectToys() const;
 
   // After SolveXXX()
   void PrintAccImp() const;
@@ -242,8 +278,10 @@ public:
 
   void PrintInfWei() const;
   void PrintMaxVar() const;
+  void PrintSensitivity() const;
 
   void PrintStatus() const;
+  void PrintMemory() const;
 
   //----------------------------------------------------------------------------
   // Utilities
@@ -263,6 +301,8 @@ public:
   void InspectLike(const Int_t n);
   void InspectLike(const Int_t n, TString FilNam);
 
+  void InspectToys(const Int_t NumToy, const UInt_t Seed);
+
   Int_t InspectResult() const;
 
   void LatexResult(const TString FilNam) const;
@@ -285,9 +325,7 @@ private:
   TString Versio;
 
   // The date
-  TDatime* Date;
   TString  Today;
-  TString* Months;
 
   // Actual values of estimates, uncertainties and observables
   Int_t InpEst, InpUnc, InpObs;
@@ -320,6 +358,20 @@ private:
   TMatrixD** StoSca;
   Int_t      FaiFac;
 
+  // The derivatives of SolveSensitivity()
+  TMatrixD** ValSen;
+  TMatrixD** SigSen;
+
+  // The base covariance for the scans of correlations, see FillScaBase()
+  Int_t     ScaLow;
+  Int_t     ScaBas;
+  Int_t     ScaFut;
+  Int_t     ScaUpd;
+  TMatrixD* BasFac;
+  TMatrixD* BasFij;
+  TMatrixD* BasCovI;
+  TMatrixD* BasCovU;
+
   // Arrays of indices of changed, scaled or reduced correlations
   Int_t* UncCha;
   Int_t* UncFac;
@@ -345,9 +397,21 @@ private:
   // Control flag for all input filled and fixed
   Int_t InpFil, InpFix;
 
-  // Control flag for parameters caculated
+  // Control flags for changes since the last FixInp()
+  // InpDir = 1 the selection changed, UncDir[k] = 1 correlations of 
+  // source k may have changed
+  Int_t  InpDir;
+  Int_t* UncDir;
+
+  // Control flag for parameters caculated, on demand by const getters
   Int_t IsCalcParams;
 
+  // Control flag for a positive definite covariance
+  Int_t IsPosDef;
+
+  // Control flag for a diagonal plus low rank covariance
+  Int_t IsLowRank;
+
   // Control flags for combination performed
   Int_t IsSolve;
   Int_t IsSolveRelUnc;
@@ -356,12 +420,17 @@ private:
   Int_t IsSolveInfWei;
   Int_t IsSolvePosWei;
   Int_t IsSolveMaxVar;
+  Int_t IsSolveSensit;
 
   // Control flag and matrix of coefficients for iterative Blue
   Int_t IsRelUncMode;
   static const Int_t MaxCof = 3;
   TMatrixD* Cof;
 
+  // The number of iterations and combined values per iteration for SolveRelUnc
+  Int_t     NumRel;
+  TMatrixD* HisRel;
+
   // The list of importance of estimates for SolveAccImp == abs(weight) 
   Double_t  PreAcc;
   Int_t     IntAcc;
@@ -373,15 +442,6 @@ private:
   TMatrixD* StaImp;
   TMatrixD* SysImp;
 
-  // The arrays for DisplayAny
-  Int_t*    Indx;
-  Int_t*    Colo;
-  TString*  Name;
-  Double_t* Valu;
-  Double_t* Stat;
-  Double_t* Syst;
-  Double_t* Full;
-
   // The list of:
   // 1) initial/final variances/correlations for SolveMaxVar
   // 2) the rho values 
@@ -398,6 +458,7 @@ private:
   Int_t     IFuCor;
   Int_t     IFuFla;
   Int_t*    IFuFai;
+  Double_t  TolMax;
 
   // Control flag for print out level
   Int_t IPrint;
@@ -405,12 +466,50 @@ private:
   // Control flag for quiet mode
   Int_t IQuiet;
 
+  // Control flag for the thread-safe mode, common to all instances,
+  // atomic since it is read by the instances solved in parallel threads
+  static std::atomic<Int_t> IThrSaf;
+
+  // Number of threads for the scans
+  Int_t NumThr;
+
+  // The workspace for the temporaries of FixInp() and Solve(), one matrix
+  // per temporary, such that it is only re-allocated if the number of active
+  // estimates, observables or uncertainties changed, see FillZero().
+  //  0- 2: FixInp(), 3- 4: FillCovInvert(), 5: FillCovLowRank(), 6-15: Solve()
+  // 16-19: SolvePosWei(), 20-25: FillScaBase(), 26-29: CalcAccImp()
+  // 30-33: FillChiBase() and CalcChiRes(), 34-35: CalcMaxVar()
+  // 36: SolveRelUnc(), 37-38: SolveMaxVar(), 39: InspectToys(), 40: CalcAccImp()
+  // 41-44: SolveSensitivity()
+  // WrkInt holds InpUncOrig integers for FixInp() and then InpEstOrig ones
+  // for FillScaBase() and CalcAccImp()
+  // NumAll counts all allocations done by FillZero()
+  static const Int_t WrkNum = 45;
+  TMatrixD** WrkMat;
+  TVectorD*  WrkVec;
+  Int_t*     WrkInt;
+  Int_t      NumAll;
+
+  // The workspace of CalcScaRho() with SloNum matrices and InpEstOrig
+  // integers per slot, one slot per thread of the scans, see FillSloWrk().
+  // CalcToys() uses the matrices 0-8 of its slot.
+  // SloAll counts the allocations per slot.
+  static const Int_t SloNum = 10;
+  Int_t      SloMax;
+  TMatrixD** SloMat;
+  Int_t*     SloInt;
+  Int_t*     SloAll;
+
+  // The number of groups of data members for PrintMemory()
+  static const Int_t MemGrp = 8;
+
   // Save harbor for all input
   Int_t     InpEstOrig, InpUncOrig, InpObsOrig;
   TVectorD* XvaOrig;
   TVectorD* SigOrig;
-  TMatrixD* UncOrig;
-  TMatrixD* CorOrig;
+  TVectorD*  UncOrig;
+  TMatrixD** CorOrig;
+  Int_t*     CorTypOrig;
   TMatrixD* UmaOrig;
   TMatrixD* UtrOrig;
   
@@ -422,11 +521,24 @@ private:
   TVectorD* Xva;
   TVectorD* Sig;
 
+  // Per source uncertainties Unc(i+k*InpEst) and correlations Cor[k](i,j)
+  // CorTyp[k] = 0 / 1 / 2 = uncorrelated / fully correlated / general
+  TVectorD*  Unc;
+  TMatrixD** Cor;
+  Int_t*     CorTyp;
+
   // Matrices to do the job
-  TMatrixD* Unc;
-  TMatrixD* Cor;
   TMatrixD* Cov;
+  TMatrixD* CovL;
   TMatrixD* CovI;
+
+  // Diagonal plus low rank covariance Cov = D + S * ST with D = CovD, 
+  // S = CovS, and CovW the Cholesky factor of (1 + ST * D-1 * S), CovT is
+  // the workspace of CalcCovSolve(). Cov and CovI are filled nevertheless
+  TVectorD* CovD;
+  TMatrixD* CovS;
+  TMatrixD* CovW;
+  TMatrixD* CovT;
   TMatrixD* Rho;
   TMatrixD* Lam;
   TVectorD* Pul;
@@ -466,7 +578,11 @@ private:
   Int_t    NotRel;
 
   // Matrices for the InspectLike results
-  TMatrixD* ChiRes;
+  // The base for CalcChiRes(), see FillChiBase()
+  Int_t     ChiFac;
+  Double_t  ChiDet;
+  TMatrixD* ChiCov;
+  TMatrixD* ChiCovI;
   static const Int_t LikDim = 7;
   TMatrixD* LikRes;
   Int_t     LikFla;
@@ -474,6 +590,19 @@ private:
   // Control flags for InspectLike
   Int_t IsInspectLike;
 
+  // Matrices for the InspectToys results, see there
+  static const Int_t ToyDim = 6;
+  static const Int_t ToyBin = 40;
+  static const Int_t ToyBat = 256;
+  TMatrixD* ToyRes;
+  TMatrixD* ToyPul;
+  TMatrixD* ToyPro;
+  Int_t     ToyNum;
+  Double_t  ToyChq;
+
+  // Control flags for InspectToys
+  Int_t IsInspectToys;
+
 private:
   //----------------------------------------------------------------------------
   // Private Functions do do the job
@@ -499,15 +628,24 @@ private:
   void SetIsSolvedInfWei(const Int_t l);
   void SetIsSolvedPosWei(const Int_t l);
   void SetIsSolvedMaxVar(const Int_t l);
+  void SetIsSolvedSensit(const Int_t l);
   void SetIsInspectLike(const Int_t l);
+  void SetIsInspectToys(const Int_t l);
 
   //----------------------------------------------------------------------------
   // Fillers
   //----------------------------------------------------------------------------
   void FillCov();
   void FillCovInvert();
+  Int_t FillCovLowRank();
   void FillSig();
   void FillRho();
+  Int_t FillScaBase(const TMatrixD *UseFac, const TMatrixD *UseFij);
+  void FillChiBase();
+  void FillZero(TMatrixD **Mat, const Int_t NRows, const Int_t NCols);
+  void FillZero(TMatrixD **Mat, const Int_t NRows, const Int_t NCols, Int_t *NumAlo) const;
+  void FillZero(TVectorD **Vec, const Int_t NRows);
+  void FillSloWrk(const Int_t NumSlo);
 
   //----------------------------------------------------------------------------
   // Getters
@@ -548,6 +686,11 @@ private:
 
   Int_t IsCalcedParams() const;
 
+  Int_t IsPosDefCov() const;
+
+  Int_t IsLowRankCov() const;
+  Int_t IsLowRankScan() const;
+
   Int_t IsSolved() const;
   Int_t IsSolvedRelUnc() const;
   Int_t IsSolvedAccImp() const;
@@ -555,14 +698,15 @@ private:
   Int_t IsSolvedInfWei() const;
   Int_t IsSolvedPosWei() const;
   Int_t IsSolvedMaxVar() const;
+  Int_t IsSolvedSensit() const;
   Int_t IsSolvedAnyWay() const;
 
   Int_t IsInspectedLike() const;
+  Int_t IsInspectedToys() const;
 
   Int_t IsRelValUnc() const;
 
   Int_t IsPrintLevel() const;
-  Int_t IsQuiet() const;
 
   Int_t IsFutchCor() const;
 
@@ -592,6 +736,11 @@ private:
 
   void SetCalcedParams(const Int_t l);
 
+  void SetPosDefCov(const Int_t l);
+
+  void SetLowRankCov(const Int_t l);
+  void SetLowRankScan(const Int_t l);
+
   void SetFutchCor(const Int_t i, const Int_t j, const Int_t l, const Double_t RhoFut);
 
   //----------------------------------------------------------------------------
@@ -602,10 +751,42 @@ private:
   // Calculate
   //----------------------------------------------------------------------------
   Double_t CalcRelUnc(const Int_t i, const Int_t k, const Double_t ValCom) const;
+  Double_t CalcRelVar(const Int_t i, const Int_t k, const Double_t ValCom) const;
   Double_t Likelihood(const Double_t* x, const Double_t* par) const;
-  void     CalcChiRes(const Int_t n, const Int_t IsLike, const Double_t xt) const;
+  void     CalcChiRes(const Int_t n, const Int_t IsLike, const Double_t xt, Double_t *RetChi) const;
+  Double_t CalcLikMax(const Int_t n, const Int_t IsLike, const Double_t xlow, const Double_t xhig) const;
+  Int_t    CalcLikCro(const Int_t n, const Int_t IsLike, const Double_t xmax, const Double_t LogMax,
+		      const Double_t xend, const Double_t xbra, Double_t *xcro) const;
+  void     CalcLikGau(const Int_t n, Double_t *xmax, Double_t *xsig) const;
+  Double_t CalcToyGau(const UInt_t Seed, const ULong64_t Cnt) const;
+  void     CalcToys(const UInt_t Seed, const Long64_t ToyFir, const Int_t NumBat, const TMatrixD *L,
+		    const Int_t q) const;
 
   void CalcParams();
+  Long64_t CalcMemory(const Int_t IGrp) const;
+  Long64_t CalcMemory(const TMatrixD *Mat) const;
+  Long64_t CalcMemory(const TVectorD *Vec) const;
+
+  Int_t CalcCholesky(const TMatrixD *InpMat, TMatrixD *OutLow) const;
+  void  CalcCholSolve(const TMatrixD *InpLow, TMatrixD *InOMat) const;
+  void  CalcCholInvert(const TMatrixD *InpLow, TMatrixD *OutMat) const;
+  void  CalcCovSolve(TMatrixD *InOMat) const;
+
+  Int_t CalcAccImp(const Int_t n, const Int_t ActPre, const Int_t NumEst);
+  Double_t CalcScaCor(const Int_t k, const Int_t i, const Int_t j, 
+		      const TMatrixD *UseFac, const TMatrixD *UseFij) const;
+  void     CalcScaCov(const TMatrixD *UseFac, const TMatrixD *UseFij, TMatrixD *OutCov) const;
+  Int_t    CalcScaCha(const TMatrixD *UseFac, const TMatrixD *UseFij, Int_t *LisCha) const;
+  Int_t    CalcScaCap(const TMatrixD *UseFac, const TMatrixD *UseFij, const Int_t NumCha, 
+		      const Int_t *LisCha, TMatrixD *D, TMatrixD *S) const;
+  void     CalcScaPre(TVectorD *SigPre) const;
+  Int_t    CalcScaRho(const TMatrixD *UseFac, const TMatrixD *UseFij, const TVectorD *SigPre, 
+		      const Int_t p, const Int_t q, TMatrixD *RetVal, TMatrixD *RetVar, Int_t *IWoo) const;
+
+  Double_t CalcMaxVar(const Int_t n, const Int_t k, const Int_t l, const Double_t RhoFac,
+		      const Int_t IScan, const TVectorD *SigPre);
+  Double_t CalcMaxFac(const Int_t n, const Int_t k, const Int_t l, const Double_t RhoIni, 
+		      Double_t *VarRun, const Int_t IScan, const TVectorD *SigPre);
 
   void     ResetScaRho(const Int_t IFlag);
   Double_t CalcActFac(const Int_t i, const Int_t j, const Int_t k);
@@ -623,7 +804,10 @@ private:
   // Display
   //----------------------------------------------------------------------------
   void PlotRes(const Int_t N, const TString FilNam, 
-	       const TString ForVal, const TString ForUnc) const;
+	       const TString ForVal, const TString ForUnc,
+	       const Int_t *Indx, const Int_t *Colo, const TString *Name,
+	       const Double_t *Valu, const Double_t *Stat, const Double_t *Syst,
+	       const Double_t *Full) const;
 
   // The Class definition
   ClassDef(Blue,0);
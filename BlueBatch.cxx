@@ -0,0 +1,264 @@
+//-----------------------------------------------------------------------------
+//
+// BLUE: A ROOT class implementing the Best Linear Unbiased Estimate method.
+//
+// Copyright (C) 2012-2014, Richard.Nisius@mpp.mpg.de
+// All rights reserved
+//
+// This file is part of BLUE - Version 2.1.0.
+//
+// BLUE is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// For the licensing terms see the file COPYING or http://www.gnu.org/licenses.
+//
+//-----------------------------------------------------------------------------
+#include "TObject.h"
+#include "TROOT.h"
+#include "TMatrixD.h"
+#include "RVersion.h"
+#include "RConfigure.h"
+#if defined(R__USE_IMT) && ROOT_VERSION_CODE >= ROOT_VERSION(6,10,0)
+#define Blue_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+#include "BlueBatch.h"
+
+// ----> First the implementation of the public member functions
+
+//------------------------------------------------------------------------------
+// Constructor
+//------------------------------------------------------------------------------
+
+ClassImp(BlueBatch);
+
+BlueBatch::BlueBatch() : TObject() {
+  NumThr = 1;
+  NumDon = 0;
+};
+
+//------------------------------------------------------------------------------
+
+BlueBatch::BlueBatch(const Int_t n) : TObject() {
+  NumThr = 1;
+  NumDon = 0;
+  SetNumThreads(n);
+};
+
+//------------------------------------------------------------------------------
+// Destructor
+//------------------------------------------------------------------------------
+
+BlueBatch::~BlueBatch(){
+  // The batch owns the objects
+  for(Int_t i = 0; i<GetNumBlue(); i++){
+    delete LisBlu[i]; LisBlu[i] = NULL;
+  }
+  LisBlu.clear();
+  LisDxr.clear();
+  LisSta.clear();
+};
+
+//------------------------------------------------------------------------------
+// Filler
+//------------------------------------------------------------------------------
+
+Int_t BlueBatch::AddBlue(Blue *myBlue){
+  return AddBlue(myBlue, 0);
+};
+
+//------------------------------------------------------------------------------
+
+Int_t BlueBatch::AddBlue(Blue *myBlue, const Double_t Dx){
+  // Returns the index of the object in the batch, -1 if not added
+  if(myBlue == NULL){
+    printf("... BlueBatch->AddBlue(): IGNORED No object given \n");
+    return -1;
+  }else if(Dx < 0){
+    printf("... BlueBatch->AddBlue(%5.3f%%): IGNORED I expect a relative precision in %% \n", Dx);
+    return -1;
+  }
+
+  // The batch owns its objects, the same one must not be solved twice
+  for(Int_t i = 0; i<GetNumBlue(); i++){
+    if(LisBlu[i] == myBlue){
+      printf("... BlueBatch->AddBlue(): IGNORED Object already in the batch at %2i \n", i);
+      return -1;
+    }
+  }
+  LisBlu.push_back(myBlue);
+  LisDxr.push_back(Dx);
+  LisSta.push_back(0);
+  return GetNumBlue() - 1;
+};
+
+//------------------------------------------------------------------------------
+// Solver
+//------------------------------------------------------------------------------
+
+void BlueBatch::Solve(){
+
+  // Only the objects added since the last call are solved
+  Int_t NumBlu = GetNumBlue();
+  if(NumDon == NumBlu){
+    printf("... BlueBatch->Solve(): IGNORED No object added since the last call \n");
+    return;
+  }
+
+  // The objects are quiet while they are solved, otherwise the printout
+  // of the threads interleaves, their own setting is restored afterwards
+  std::vector<Int_t> LisQui(NumBlu - NumDon, 0);
+  for(Int_t i = NumDon; i<NumBlu; i++){
+    LisQui[i-NumDon] = LisBlu[i]->IsQuiet();
+    LisBlu[i]->SetQuiet();
+  }
+
+  // The objects are independent, each one is only touched by one thread.
+  // In threads Blue runs in its thread-safe mode, i.e. without figures.
+  // The pool hands out the objects one by one, such that threads which
+  // finished their small problems take the next ones. The mode is common
+  // to all instances, therefore the previous one is restored afterwards.
+  Int_t IDone = 0;
+#ifdef Blue_IMT
+  if(GetNumThreads() > 1){
+    Int_t ISafe = Blue::IsThreadSafe();
+    if(ISafe == 0)Blue::SetThreadSafe();
+    ROOT::EnableThreadSafety();
+    ROOT::TThreadExecutor Pool(GetNumThreads());
+    Pool.Foreach([&](Int_t i){SolveOne(NumDon + i);}, ROOT::TSeqI(NumBlu - NumDon));
+    if(ISafe == 0)Blue::SetNotThreadSafe();
+    IDone = 1;
+  }
+#endif
+  if(IDone == 0){
+    for(Int_t i = NumDon; i<NumBlu; i++)SolveOne(i);
+  }
+  for(Int_t i = NumDon; i<NumBlu; i++){
+    if(LisQui[i-NumDon] == 0)LisBlu[i]->SetNotQuiet();
+  }
+
+  // Report
+  Int_t NumFai = 0;
+  for(Int_t i = NumDon; i<NumBlu; i++)if(LisSta[i] != 1)NumFai = NumFai + 1;
+  printf("... BlueBatch->Solve(): Solved %4i objects with %2i threads,", NumBlu - NumDon, GetNumThreads());
+  printf(" %4i of them failed, see GetStatus() \n", NumFai);
+  NumDon = NumBlu;
+  return;
+};
+
+//------------------------------------------------------------------------------
+// Geters
+//------------------------------------------------------------------------------
+
+Int_t BlueBatch::GetNumBlue() const {
+  return static_cast<Int_t>(LisBlu.size());
+};
+
+//------------------------------------------------------------------------------
+
+Int_t BlueBatch::GetNumThreads() const {
+  return NumThr;
+};
+
+//------------------------------------------------------------------------------
+
+Blue* BlueBatch::GetBlue(const Int_t i) const {
+  if(IsIndexBlue(i) == 0){
+    printf("... BlueBatch->GetBlue(%4i): IGNORED Not a valid index \n", i);
+    return NULL;
+  }
+  return LisBlu[i];
+};
+
+//------------------------------------------------------------------------------
+
+Int_t BlueBatch::GetStatus(const Int_t i) const {
+  // The return of Blue::InspectResult(), i.e. 1 = ok, 0 = not solved and < 0
+  // for a solution with problems
+  if(IsIndexBlue(i) == 0){
+    printf("... BlueBatch->GetStatus(%4i): IGNORED Not a valid index \n", i);
+    return 0;
+  }
+  return LisSta[i];
+};
+
+//------------------------------------------------------------------------------
+
+Int_t BlueBatch::GetResult(const Int_t i, TMatrixD *UseResult) const {
+  if(IsIndexBlue(i) == 0){
+    printf("... BlueBatch->GetResult(%4i): IGNORED Not a valid index \n", i);
+    return 0;
+  }
+  return LisBlu[i]->GetResult(UseResult);
+};
+
+//------------------------------------------------------------------------------
+
+Int_t BlueBatch::GetUncert(const Int_t i, TMatrixD *UseUncert) const {
+  if(IsIndexBlue(i) == 0){
+    printf("... BlueBatch->GetUncert(%4i): IGNORED Not a valid index \n", i);
+    return 0;
+  }
+  return LisBlu[i]->GetUncert(UseUncert);
+};
+
+//------------------------------------------------------------------------------
+// Setters
+//------------------------------------------------------------------------------
+
+void BlueBatch::SetNumThreads(const Int_t n){
+  if(n < 1){
+    printf("... BlueBatch->SetNumThreads(%2i): IGNORED At least one thread is needed \n", n);
+    return;
+  }
+#ifdef Blue_IMT
+  NumThr = n;
+#else
+  NumThr = 1;
+  if(n > 1){
+    printf("... BlueBatch->SetNumThreads(%2i): ROOT without multi-threading, I use one thread \n", n);
+  }
+#endif
+  return;
+};
+
+//------------------------------------------------------------------------------
+// Print Out
+//------------------------------------------------------------------------------
+
+void BlueBatch::PrintStatus() const {
+  printf("... BlueBatch->PrintStatus(): %4i objects, %4i of them solved, %2i threads \n",
+	 GetNumBlue(), NumDon, GetNumThreads());
+  for(Int_t i = 0; i<NumDon; i++){
+    if(LisSta[i] != 1){
+      printf("... BlueBatch->PrintStatus(): Object %4i has status %4i \n", i, LisSta[i]);
+    }
+  }
+  return;
+};
+
+// ---- Now the private member functions
+
+//------------------------------------------------------------------------------
+
+Int_t BlueBatch::IsIndexBlue(const Int_t i) const {
+  if(i >= 0 && i < GetNumBlue())return 1;
+  return 0;
+};
+
+//------------------------------------------------------------------------------
+
+void BlueBatch::SolveOne(const Int_t i){
+  // Only touches object i and its entry in LisSta
+  Blue *myBlue = LisBlu[i];
+  myBlue->FixInp();
+  if(LisDxr[i] > 0){
+    myBlue->SolveRelUnc(LisDxr[i]);
+  }else{
+    myBlue->Solve();
+  }
+  LisSta[i] = myBlue->InspectResult();
+  return;
+};
@@ -0,0 +1,110 @@
+//-----------------------------------------------------------------------------
+//
+// BLUE: A ROOT class implementing the Best Linear Unbiased Estimate method.
+//
+// Copyright (C) 2012-2014, Richard.Nisius@mpp.mpg.de
+// All rights reserved
+//
+// This file is part of BLUE - Version 2.1.0.
+//
+// BLUE is free software: you can redistribute it and/or modify it under the
+// terms of the GNU Lesser General Public License as published by the Free
+// Software Foundation, either version 3 of the License, or (at your option)
+// any later version.
+//
+// For the licensing terms see the file COPYING or http://www.gnu.org/licenses.
+//
+//-----------------------------------------------------------------------------
+#ifndef BlueBatch_H
+#define BlueBatch_H
+
+#include <vector>
+#include "Blue.h"
+
+//-----------------------------------------------------------------------------
+// BlueBatch solves many independent Blue objects, e.g. one per bin or
+// channel, on a pool of threads. Each object is filled and configured as
+// usual, added to the batch, and solved by FixInp() and Solve(), or
+// SolveRelUnc() if a precision was given. The results are kept in the order
+// the objects were added. The batch owns the objects it holds.
+//-----------------------------------------------------------------------------
+
+class BlueBatch: public TObject {
+
+public:
+
+  //----------------------------------------------------------------------------
+  // The Interface of the Class
+  //----------------------------------------------------------------------------
+
+  //----------------------------------------------------------------------------
+  // Constructor
+  //----------------------------------------------------------------------------
+  BlueBatch();
+  BlueBatch(const Int_t n);
+
+  //----------------------------------------------------------------------------
+  // Destructor
+  //----------------------------------------------------------------------------
+  ~BlueBatch();
+
+  //----------------------------------------------------------------------------
+  // Filler
+  //----------------------------------------------------------------------------
+  Int_t AddBlue(Blue *myBlue);
+  Int_t AddBlue(Blue *myBlue, const Double_t Dx);
+
+  //----------------------------------------------------------------------------
+  // Solver
+  //----------------------------------------------------------------------------
+  void Solve();
+
+  //----------------------------------------------------------------------------
+  // Geters
+  //----------------------------------------------------------------------------
+  Int_t GetNumBlue() const;
+  Int_t GetNumThreads() const;
+  Blue* GetBlue(const Int_t i) const;
+  Int_t GetStatus(const Int_t i) const;
+  Int_t GetResult(const Int_t i, TMatrixD *UseResult) const;
+  Int_t GetUncert(const Int_t i, TMatrixD *UseUncert) const;
+
+  //----------------------------------------------------------------------------
+  // Setters
+  //----------------------------------------------------------------------------
+  void SetNumThreads(const Int_t n);
+
+  //----------------------------------------------------------------------------
+  // Print Out
+  //----------------------------------------------------------------------------
+  void PrintStatus() const;
+
+private:
+
+  //----------------------------------------------------------------------------
+  // Data members
+  //----------------------------------------------------------------------------
+
+  // The objects, the precision for SolveRelUnc() per object, 0 = Solve(),
+  // and the return of Blue::InspectResult() after solving, 0 = not solved
+  std::vector<Blue*>    LisBlu; //!
+  std::vector<Double_t> LisDxr; //!
+  std::vector<Int_t>    LisSta; //!
+
+  // Number of threads
+  Int_t NumThr;
+
+  // Number of objects already passed to Solve(), see there
+  Int_t NumDon;
+
+  //----------------------------------------------------------------------------
+  // Private functions
+  //----------------------------------------------------------------------------
+  Int_t IsIndexBlue(const Int_t i) const;
+  void  SolveOne(const Int_t i);
+
+  // The Class definition
+  ClassDef(BlueBatch,0);
+
+};
+#endif
@@ -5,5 +5,6 @@
 #pragma link off all functions;
 
 #pragma link C++ class Blue;
+#pragma link C++ class BlueBatch;
 
 #endif